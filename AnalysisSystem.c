@@ -0,0 +1,490 @@
+/*
+* Programmed By: Aaron Gabrielle Dichoso
+*
+* Description:
+* 	AnalysisSystem.c: An analysis system to be used for the Machine Project.
+*       Solves the playing grid with full knowledge of every tile, which gives the best possible number of actions
+*       that LRRH's own moves can be compared against. Also solves the Markov chain of random mode, which gives the exact
+*       chance of winning without playing any games, and finds the states random mode can never end from.
+*
+* Last Modified: 19/10/2026
+* Acknowledgements:
+*       Breadth First Search Algorithm - https://www.youtube.com/watch?v=oDqjPvD54Ss
+*       Transposition Table - https://www.chessprogramming.org/Transposition_Table
+*       Competitive Analysis - https://en.wikipedia.org/wiki/Competitive_analysis_(online_algorithm)
+*       Absorbing Markov Chains - https://en.wikipedia.org/wiki/Absorbing_Markov_chain
+*       Gauss-Seidel Method - https://en.wikipedia.org/wiki/Gauss%E2%80%93Seidel_method
+*/
+
+#include "AnalysisSystem_prototype.h"
+
+/* This function gives the index of a state, which is also its index in the tables of the analysis
+        @param   (int)  nXLocation is the X location of LRRH
+        @param   (int)  nYLocation is the Y location of LRRH
+        @param   (int)  nDirection is the index of the direction LRRH is facing (Ex: 2 for south)
+        @param   (int)  nItemFlags contains the ANALYSIS_FLAG bits of the items LRRH carries
+        @param   (int)  nGridSize is the size of the playing grid
+
+        @return  (int) the index of the state
+*/
+int
+encodeAnalysisState (int nXLocation, int nYLocation, int nDirection, int nItemFlags, int nGridSize)
+{
+        return ((nXLocation * nGridSize + nYLocation) * NUM_OF_DIRECTIONS + nDirection) * ANALYSIS_NUM_OF_ITEM_SETS + nItemFlags;
+}
+
+/* This function gives the state after LRRH rotates, she stays on the same tile with the same items.
+   The new direction is given by the same functions the game rotates LRRH with, so the analysis turns exactly like she does.
+        @param   (int)  nState is the index of the current state
+        @param   (int)  nIsRightRotation tells whether LRRH rotates to the right (1) or to the left (0)
+
+        @return  (int) the index of the rotated state
+*/
+int
+rotateAnalysisState (int nState, int nIsRightRotation)
+{
+        int nItemFlags = nState % ANALYSIS_NUM_OF_ITEM_SETS;
+        char cDirection = convertIndexToDirectionSymbol ((nState / ANALYSIS_NUM_OF_ITEM_SETS) % NUM_OF_DIRECTIONS);
+        int nTile = nState / (ANALYSIS_NUM_OF_ITEM_SETS * NUM_OF_DIRECTIONS);
+
+        if (nIsRightRotation)
+                cDirection = simulateRightLRRHRotation (cDirection);
+        else
+                cDirection = simulateLeftLRRHRotation (cDirection);
+
+        return (nTile * NUM_OF_DIRECTIONS + convertDirectionSymbolToIndex (cDirection)) * ANALYSIS_NUM_OF_ITEM_SETS + nItemFlags;
+}
+
+/* This function gives the items LRRH carries after stepping on a tile, using the same rules as the game
+        @param   (char)  cTile is the symbol of the tile LRRH steps on
+        @param   (int)  nItemFlags contains the ANALYSIS_FLAG bits of the items LRRH carries before stepping on the tile
+
+        @return  (int) the new item flags, -1 if LRRH loses the game on the tile
+*/
+int
+applyAnalysisTile (char cTile, int nItemFlags)
+{
+        switch (cTile){
+        case PIT_TILE:
+                return -1;
+        case WOLF_TILE:
+                //The wolf only lets LRRH pass if she gives up her bread
+                if (nItemFlags & ANALYSIS_FLAG_BREAD)
+                        return nItemFlags & ~ANALYSIS_FLAG_BREAD;
+                else
+                        return -1;
+        case BAKERY_TILE:
+                return nItemFlags | ANALYSIS_FLAG_BREAD;
+        case FLOWER_TILE:
+                return nItemFlags | ANALYSIS_FLAG_FLOWER;
+        case WOODSMAN_TILE:
+                return nItemFlags | ANALYSIS_FLAG_WOODSMAN;
+        default:
+                return nItemFlags;
+        }
+}
+
+/* This function gives the state after LRRH moves forward, using the same rules as the game
+        @param   (int)  nState is the index of the current state
+        @param   (char *)  pPlayGrid is the pointer to carrPlayGrid (after every object has been placed)
+        @param   (int)  nStartXLocation is the X location LRRH starts at (her own symbol is there, so it is treated as empty)
+        @param   (int)  nStartYLocation is the Y location LRRH starts at
+        @param   (int)  nGridSize is the size of the playing grid
+
+        @return  (int) the index of the next state, or ANALYSIS_STATE_WIN / ANALYSIS_STATE_LOSS if the game ends,
+                or ANALYSIS_STATE_BLOCKED if LRRH is facing the edge of the playing grid
+*/
+int
+moveAnalysisStateForward (int nState, char * pPlayGrid, int nStartXLocation, int nStartYLocation, int nGridSize)
+{
+        int nItemFlags = nState % ANALYSIS_NUM_OF_ITEM_SETS;
+        int nDirection = (nState / ANALYSIS_NUM_OF_ITEM_SETS) % NUM_OF_DIRECTIONS;
+        int nTile = nState / (ANALYSIS_NUM_OF_ITEM_SETS * NUM_OF_DIRECTIONS);
+
+        char cDirection = convertIndexToDirectionSymbol (nDirection);
+        int nNextXLocation = nTile / nGridSize + convertDirectionSymbolToXMovement (cDirection);
+        int nNextYLocation = nTile % nGridSize + convertDirectionSymbolToYMovement (cDirection);
+
+        if (!isLocationValid (nNextXLocation, nNextYLocation, nGridSize - 1))
+                return ANALYSIS_STATE_BLOCKED;
+
+        char cNextTile = *(pPlayGrid + nNextXLocation * nGridSize + nNextYLocation);
+
+        if (nNextXLocation == nStartXLocation && nNextYLocation == nStartYLocation)
+                cNextTile = EMPTY_TILE;
+
+        //Granny's house ends the game, it is only a win if LRRH has every item
+        if (cNextTile == GRANDMA_TILE){
+                if (nItemFlags == ANALYSIS_ALL_FLAGS)
+                        return ANALYSIS_STATE_WIN;
+                else
+                        return ANALYSIS_STATE_LOSS;
+        }
+
+        int nNextItemFlags = applyAnalysisTile (cNextTile, nItemFlags);
+
+        if (nNextItemFlags == -1)
+                return ANALYSIS_STATE_LOSS;
+
+        return encodeAnalysisState (nNextXLocation, nNextYLocation, nDirection, nNextItemFlags, nGridSize);
+}
+
+/* This function gives the states random mode can go to from a state, in the order rotate left, move forward, rotate right.
+   Sensing is left out since it always stays on the same state.
+        @param   (int)  nState is the index of the current state
+        @param   (char *)  pPlayGrid is the pointer to carrPlayGrid (after every object has been placed)
+        @param   (int)  nStartXLocation is the X location LRRH starts at
+        @param   (int)  nStartYLocation is the Y location LRRH starts at
+        @param   (int)  nGridSize is the size of the playing grid
+        @param   (int *)  pNextStates is the pointer to where the 3 next states will be saved
+                (a state index, or ANALYSIS_STATE_WIN / ANALYSIS_STATE_LOSS if the game ends)
+
+        @return  (void) no return value
+*/
+void
+getRandomAnalysisNextStates (int nState, 
+                                char * pPlayGrid, 
+                                int nStartXLocation, 
+                                int nStartYLocation, 
+                                int nGridSize, 
+                                int * pNextStates)
+{
+        pNextStates[0] = rotateAnalysisState (nState, 0);
+        pNextStates[1] = moveAnalysisStateForward (nState, pPlayGrid, nStartXLocation, nStartYLocation, nGridSize);
+        pNextStates[2] = rotateAnalysisState (nState, 1);
+
+        //Facing the edge, moving forward rotates LRRH to the right instead
+        if (pNextStates[1] == ANALYSIS_STATE_BLOCKED)
+                pNextStates[1] = pNextStates[2];
+}
+
+/* This function finds every state of random mode that can still lead to an ending (a win or a loss).
+   A game in any other state can never end, since LRRH can only keep moving between states that cannot end either.
+
+   The states are linked backwards (from each next state to the states before it), then a breadth first search
+   starts from every state that can end the game in one action.
+
+        @param   (char *)  pPlayGrid is the pointer to carrPlayGrid (after every object has been placed)
+        @param   (int)  nStartXLocation is the X location LRRH starts at
+        @param   (int)  nStartYLocation is the Y location LRRH starts at
+        @param   (int)  nGridSize is the size of the playing grid
+        @param   (unsigned char *)  pCanEndStates is the pointer to where the results will be saved, one for each state
+                (1 if the game can still end from the state, 0 if not)
+
+        @return  (void) no return value
+*/
+void
+markEndingAnalysisStates (char * pPlayGrid,
+                                int nStartXLocation,
+                                int nStartYLocation,
+                                int nGridSize,
+                                unsigned char * pCanEndStates)
+{
+        int nNumOfStates = nGridSize * nGridSize * NUM_OF_DIRECTIONS * ANALYSIS_NUM_OF_ITEM_SETS;
+
+        //Next states of every state
+        int * pNextStates = malloc (nNumOfStates * 3 * sizeof(int));
+
+        //States before each state, stored one after the other: the states before state i start at pPreviousStarts[i]
+        int * pPreviousStarts = malloc ((nNumOfStates + 1) * sizeof(int));
+        int * pPreviousStates = malloc (nNumOfStates * 3 * sizeof(int));
+
+        //Each state is added at most once, so the queue never wraps around
+        int * pStateQueue = malloc (nNumOfStates * sizeof(int));
+        int nQueueHead = 0;
+        int nQueueTail = 0;
+        int i, j;
+
+        for (i = 0; i <= nNumOfStates; i++)
+        {
+                pPreviousStarts[i] = 0;
+        }
+
+        //Count the states before each state, then turn the counts into starting points
+        for (i = 0; i < nNumOfStates; i++)
+        {
+                getRandomAnalysisNextStates (i, pPlayGrid, nStartXLocation, nStartYLocation, nGridSize, pNextStates + i * 3);
+
+                pCanEndStates[i] = 0;
+
+                for (j = 0; j < 3; j++)
+                {
+                        if (pNextStates[i * 3 + j] >= 0)
+                                pPreviousStarts[pNextStates[i * 3 + j] + 1]++;
+                        else if (!pCanEndStates[i]){
+                                pCanEndStates[i] = 1;
+                                pStateQueue[nQueueTail++] = i;
+                        }
+                }
+        }
+
+        for (i = 0; i < nNumOfStates; i++)
+        {
+                pPreviousStarts[i + 1] += pPreviousStarts[i];
+        }
+
+        //Fill in the states before each state, moving the starting points forward as they are filled
+        for (i = 0; i < nNumOfStates; i++)
+        {
+                for (j = 0; j < 3; j++)
+                {
+                        if (pNextStates[i * 3 + j] >= 0)
+                                pPreviousStates[pPreviousStarts[pNextStates[i * 3 + j]]++] = i;
+                }
+        }
+
+        //The starting points were moved to the start of the next state, so each state ends where the one before it starts
+        while (nQueueHead < nQueueTail)
+        {
+                int nState = pStateQueue[nQueueHead++];
+                int nFirst = nState > 0 ? pPreviousStarts[nState - 1] : 0;
+
+                for (j = nFirst; j < pPreviousStarts[nState]; j++)
+                {
+                        if (!pCanEndStates[pPreviousStates[j]]){
+                                pCanEndStates[pPreviousStates[j]] = 1;
+                                pStateQueue[nQueueTail++] = pPreviousStates[j];
+                        }
+                }
+        }
+
+        free (pNextStates);
+        free (pPreviousStarts);
+        free (pPreviousStates);
+        free (pStateQueue);
+}
+
+/* This function computes the minimum number of actions (rotations and movements) LRRH needs to win the game
+   when every tile of the playing grid is known. No senses are needed since nothing is hidden.
+
+   A breadth first search is done over the states (X location, Y location, direction, items). Every action costs 1,
+   so the first time granny's house is reached with every item is the optimal answer. The table of distances works as
+   the transposition table, a state that has already been reached is never expanded again.
+
+   The wolf does not need a state of his own. He only checks if LRRH has bread, which is already part of the items.
+
+        @param   (char *)  pPlayGrid is the pointer to carrPlayGrid (after every object has been placed)
+        @param   (int)  nStartXLocation is the X location LRRH starts at
+        @param   (int)  nStartYLocation is the Y location LRRH starts at
+        @param   (char)  cStartDirection is the direction LRRH starts facing (Ex: DIRECTION_SOUTH)
+        @param   (int)  nGridSize is the size of the playing grid
+
+        @return  (int) the minimum number of actions, -1 if the game cannot be won
+*/
+int
+computeOptimalNumOfActions (char * pPlayGrid,
+                                int nStartXLocation,
+                                int nStartYLocation,
+                                char cStartDirection,
+                                int nGridSize)
+{
+        int nNumOfStates = nGridSize * nGridSize * NUM_OF_DIRECTIONS * ANALYSIS_NUM_OF_ITEM_SETS;
+
+        //Transposition table: the number of actions needed to reach each state (-1 if not reached yet)
+        int narrDistances[nNumOfStates];
+
+        //Each state is added at most once, so the queue never wraps around
+        int narrStateQueue[nNumOfStates];
+        int nQueueHead = 0;
+        int nQueueTail = 0;
+        int i;
+
+        for (i = 0; i < nNumOfStates; i++)
+        {
+                narrDistances[i] = -1;
+        }
+
+        //LRRH starts with no items
+        int nStartState = encodeAnalysisState (nStartXLocation,
+                                                nStartYLocation,
+                                                convertDirectionSymbolToIndex (cStartDirection),
+                                                0,
+                                                nGridSize);
+
+        narrDistances[nStartState] = 0;
+        narrStateQueue[nQueueTail++] = nStartState;
+
+        while (nQueueHead < nQueueTail)
+        {
+                int nState = narrStateQueue[nQueueHead++];
+                int nDistance = narrDistances[nState];
+
+                //Next states: rotate left, rotate right, then move forward
+                int narrNextStates[3];
+
+                narrNextStates[0] = rotateAnalysisState (nState, 0);
+                narrNextStates[1] = rotateAnalysisState (nState, 1);
+                narrNextStates[2] = moveAnalysisStateForward (nState, pPlayGrid, nStartXLocation, nStartYLocation, nGridSize);
+
+                if (narrNextStates[2] == ANALYSIS_STATE_WIN)
+                        return nDistance + 1;
+
+                for (i = 0; i < 3; i++)
+                {
+                        if (narrNextStates[i] >= 0 && narrDistances[narrNextStates[i]] == -1){
+                                narrDistances[narrNextStates[i]] = nDistance + 1;
+                                narrStateQueue[nQueueTail++] = narrNextStates[i];
+                        }
+                }
+        }
+
+        //Granny's house could not be reached with every item
+        return -1;
+}
+
+/* This function solves the Markov chain of random mode (decideRandomAction) to get the exact chance of winning and the
+   expected number of turns, instead of playing many games.
+
+   Every turn, LRRH rotates left, moves forward (rotates right instead if she is facing the edge), rotates right,
+   or senses (which does not change her state), with the same chances as random mode. Only the states reachable from
+   the start are kept. The chance of winning W and the expected number of turns E of each state are then solved with
+   Gauss-Seidel sweeps, using the newest values of the other states as soon as they are updated:
+
+        W(state) = (Left * W(left) + Forward * W(forward) + Right * W(right)) / (Total - Sense)
+        E(state) = (Total + Left * E(left) + Forward * E(forward) + Right * E(right)) / (Total - Sense)
+
+   where winning gives W = 1, losing gives W = 0, and both give E = 0. Sensing is taken out of both sides since it
+   always stays on the same state.
+
+        @param   (char *)  pPlayGrid is the pointer to carrPlayGrid (after every object has been placed)
+        @param   (int)  nStartXLocation is the X location LRRH starts at
+        @param   (int)  nStartYLocation is the Y location LRRH starts at
+        @param   (char)  cStartDirection is the direction LRRH starts facing (Ex: DIRECTION_SOUTH)
+        @param   (int)  nGridSize is the size of the playing grid
+        @param   (MarkovAnalysis *)  pAnalysis is the pointer to where the results will be saved
+
+        @return  (void) no return value
+*/
+void
+analyzeRandomLRRH (char * pPlayGrid,
+                        int nStartXLocation,
+                        int nStartYLocation,
+                        char cStartDirection,
+                        int nGridSize,
+                        MarkovAnalysis * pAnalysis)
+{
+        int nNumOfStates = nGridSize * nGridSize * NUM_OF_DIRECTIONS * ANALYSIS_NUM_OF_ITEM_SETS;
+
+        //Chance (out of RANDOM_ACTION_MAX_NUMBER + 1) of each action in random mode
+        int nLeftWeight = RANDOM_ROTATE_LEFT_MAX_NUMBER + 1;
+        int nForwardWeight = RANDOM_FORWARD_MAX_NUMBER - RANDOM_ROTATE_LEFT_MAX_NUMBER;
+        int nRightWeight = RANDOM_ROTATE_RIGHT_MAX_NUMBER - RANDOM_FORWARD_MAX_NUMBER;
+        int nSenseWeight = RANDOM_ACTION_MAX_NUMBER - RANDOM_ROTATE_RIGHT_MAX_NUMBER;
+        double dTotalWeight = RANDOM_ACTION_MAX_NUMBER + 1;
+        double dMovingWeight = dTotalWeight - nSenseWeight;
+
+        //Index of each state in the list of reachable states (-1 if not reachable)
+        int * pReachableIndexes = malloc (nNumOfStates * sizeof(int));
+
+        //Reachable states in the order they were found, and the reachable index (or result) of their left, forward and right actions
+        int * pReachableStates = malloc (nNumOfStates * sizeof(int));
+        int * pNextIndexes = malloc (nNumOfStates * 3 * sizeof(int));
+
+        double * pWinProbabilities = malloc (nNumOfStates * sizeof(double));
+        double * pExpectedNumOfTurns = malloc (nNumOfStates * sizeof(double));
+
+        int nNumOfReachableStates = 0;
+        int i, j;
+
+        for (i = 0; i < nNumOfStates; i++)
+        {
+                pReachableIndexes[i] = -1;
+        }
+
+        //Find every state LRRH can reach before the game ends, the list itself is used as the queue
+        int nStartState = encodeAnalysisState (nStartXLocation,
+                                                nStartYLocation,
+                                                convertDirectionSymbolToIndex (cStartDirection),
+                                                0,
+                                                nGridSize);
+
+        pReachableIndexes[nStartState] = nNumOfReachableStates;
+        pReachableStates[nNumOfReachableStates++] = nStartState;
+
+        for (i = 0; i < nNumOfReachableStates; i++)
+        {
+                int nState = pReachableStates[i];
+                int narrNextStates[3];
+
+                getRandomAnalysisNextStates (nState, pPlayGrid, nStartXLocation, nStartYLocation, nGridSize, narrNextStates);
+
+                for (j = 0; j < 3; j++)
+                {
+                        int nNextState = narrNextStates[j];
+
+                        if (nNextState < 0){
+                                pNextIndexes[i * 3 + j] = nNextState;
+                        } else {
+                                if (pReachableIndexes[nNextState] == -1){
+                                        pReachableIndexes[nNextState] = nNumOfReachableStates;
+                                        pReachableStates[nNumOfReachableStates++] = nNextState;
+                                }
+
+                                pNextIndexes[i * 3 + j] = pReachableIndexes[nNextState];
+                        }
+                }
+        }
+
+        for (i = 0; i < nNumOfReachableStates; i++)
+        {
+                pWinProbabilities[i] = 0;
+                pExpectedNumOfTurns[i] = 0;
+        }
+
+        //Keep sweeping until the values stop changing
+        int nIterations = 0;
+        int nHasConverged = 0;
+
+        while (!nHasConverged && nIterations < MARKOV_MAX_ITERATIONS)
+        {
+                double dLargestChange = 0;
+
+                for (i = 0; i < nNumOfReachableStates; i++)
+                {
+                        double dWinSum = 0;
+                        double dTurnSum = dTotalWeight;
+                        int narrWeights[3] = {nLeftWeight, nForwardWeight, nRightWeight};
+
+                        for (j = 0; j < 3; j++)
+                        {
+                                int nNextIndex = pNextIndexes[i * 3 + j];
+
+                                if (nNextIndex == ANALYSIS_STATE_WIN)
+                                        dWinSum += narrWeights[j];
+                                else if (nNextIndex >= 0){
+                                        dWinSum += narrWeights[j] * pWinProbabilities[nNextIndex];
+                                        dTurnSum += narrWeights[j] * pExpectedNumOfTurns[nNextIndex];
+                                }
+                        }
+
+                        double dNewWinProbability = dWinSum / dMovingWeight;
+                        double dNewExpectedNumOfTurns = dTurnSum / dMovingWeight;
+
+                        //The expected number of turns can be large, so its change is measured relative to its size
+                        double dWinChange = fabs (dNewWinProbability - pWinProbabilities[i]);
+                        double dTurnChange = fabs (dNewExpectedNumOfTurns - pExpectedNumOfTurns[i]) / dNewExpectedNumOfTurns;
+
+                        if (dWinChange > dLargestChange)
+                                dLargestChange = dWinChange;
+                        if (dTurnChange > dLargestChange)
+                                dLargestChange = dTurnChange;
+
+                        pWinProbabilities[i] = dNewWinProbability;
+                        pExpectedNumOfTurns[i] = dNewExpectedNumOfTurns;
+                }
+
+                nIterations++;
+                nHasConverged = dLargestChange < MARKOV_TOLERANCE;
+        }
+
+        pAnalysis->dWinProbability = pWinProbabilities[0];
+        pAnalysis->dExpectedNumOfTurns = pExpectedNumOfTurns[0];
+        pAnalysis->nNumOfStates = nNumOfReachableStates;
+        pAnalysis->nNumOfIterations = nHasConverged ? nIterations : -1;
+
+        free (pReachableIndexes);
+        free (pReachableStates);
+        free (pNextIndexes);
+        free (pWinProbabilities);
+        free (pExpectedNumOfTurns);
+}
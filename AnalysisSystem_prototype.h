@@ -0,0 +1,79 @@
+/*
+* Programmed By: Aaron Gabrielle Dichoso
+*
+* Description:
+* 	AnalysisSystem_prototype.h: Contains the function prototypes of AnalysisSystem.c
+*
+* Last Modified: 19/10/2026
+*/
+
+#include <math.h>
+
+//Bits of the items LRRH carries in an analysis state
+#define ANALYSIS_FLAG_FLOWER 1
+#define ANALYSIS_FLAG_BREAD 2
+#define ANALYSIS_FLAG_WOODSMAN 4
+#define ANALYSIS_ALL_FLAGS (ANALYSIS_FLAG_FLOWER | ANALYSIS_FLAG_BREAD | ANALYSIS_FLAG_WOODSMAN)
+#define ANALYSIS_NUM_OF_ITEM_SETS 8
+
+//Results of moving forward that do not lead to another state
+#define ANALYSIS_STATE_WIN -1
+#define ANALYSIS_STATE_LOSS -2
+#define ANALYSIS_STATE_BLOCKED -3
+
+//The Markov chain solver stops once no value changes by more than this in a sweep
+#define MARKOV_TOLERANCE 1e-10
+#define MARKOV_MAX_ITERATIONS 200000
+
+typedef struct
+{
+  //Chance of reaching granny's house with every item, starting from LRRH's first state
+  double dWinProbability;
+
+  //Expected number of turns until the game ends in any way
+  double dExpectedNumOfTurns;
+
+  //Number of states reachable by LRRH before the game ends
+  int nNumOfStates;
+
+  //Number of Gauss-Seidel sweeps done (-1 if the solver did not converge)
+  int nNumOfIterations;
+
+} MarkovAnalysis;
+
+int     encodeAnalysisState             (int nXLocation,
+                                        int nYLocation,
+                                        int nDirection,
+                                        int nItemFlags,
+                                        int nGridSize);
+int     rotateAnalysisState             (int nState,
+                                        int nIsRightRotation);
+int     applyAnalysisTile               (char cTile,
+                                        int nItemFlags);
+int     moveAnalysisStateForward        (int nState,
+                                        char * pPlayGrid,
+                                        int nStartXLocation,
+                                        int nStartYLocation,
+                                        int nGridSize);
+void    getRandomAnalysisNextStates     (int nState,
+                                        char * pPlayGrid,
+                                        int nStartXLocation,
+                                        int nStartYLocation,
+                                        int nGridSize,
+                                        int * pNextStates);
+void    markEndingAnalysisStates        (char * pPlayGrid,
+                                        int nStartXLocation,
+                                        int nStartYLocation,
+                                        int nGridSize,
+                                        unsigned char * pCanEndStates);
+int     computeOptimalNumOfActions      (char * pPlayGrid,
+                                        int nStartXLocation,
+                                        int nStartYLocation,
+                                        char cStartDirection,
+                                        int nGridSize);
+void    analyzeRandomLRRH               (char * pPlayGrid,
+                                        int nStartXLocation,
+                                        int nStartYLocation,
+                                        char cStartDirection,
+                                        int nGridSize,
+                                        MarkovAnalysis * pAnalysis);
@@ -0,0 +1,319 @@
+/*
+* Programmed By: Aaron Gabrielle Dichoso
+*
+* Description:
+* 	BitboardSystem.c: A bitboard system to be used for the Machine Project.
+*       Each row of the playing grid is stored as the bits of a single 64-bit word, which allows
+*       LRRH to check 64 tiles of a row at the same time instead of looking at them one by one.
+*
+* Last Modified: 19/10/2026
+* Acknowledgements:
+*       Bitboards - https://www.chessprogramming.org/Bitboards
+*       Flood Fill using bitboards - https://www.chessprogramming.org/Dumb7Fill
+*       Population count - https://gcc.gnu.org/onlinedocs/gcc/Other-Builtins.html
+*/
+
+#include "BitboardSystem_prototype.h"
+
+/* This function clears every bit of the bitboard
+        @param   (Bitboard *)  pBitboard is the pointer to the selected bitboard
+        @param   (int)  nGridSize is the size of the playing grid
+
+        @return  (void) no return value
+*/
+void
+clearBitboard (Bitboard * pBitboard, int nGridSize)
+{
+        int i;
+
+        for (i = 0; i < BITBOARD_MAX_GRID_SIZE; i++)
+        {
+                pBitboard->ullarrRows[i] = 0;
+        }
+
+        pBitboard->nGridSize = nGridSize;
+}
+
+/* This function sets or clears the bit of a single tile in the bitboard
+        @param   (Bitboard *)  pBitboard is the pointer to the selected bitboard
+        @param   (int)  nXLocation is the X location of the tile (the row of the bitboard)
+        @param   (int)  nYLocation is the Y location of the tile (the bit inside the row)
+        @param   (int)  nIsSet tells whether the bit should be set (1) or cleared (0)
+
+        @return  (void) no return value
+*/
+void
+setBitboardTile (Bitboard * pBitboard, int nXLocation, int nYLocation, int nIsSet)
+{
+        if (nIsSet)
+                pBitboard->ullarrRows[nXLocation] |= (1ULL << nYLocation);
+        else
+                pBitboard->ullarrRows[nXLocation] &= ~(1ULL << nYLocation);
+}
+
+/* This function gets the bit of a single tile in the bitboard
+        @param   (Bitboard *)  pBitboard is the pointer to the selected bitboard
+        @param   (int)  nXLocation is the X location of the tile (the row of the bitboard)
+        @param   (int)  nYLocation is the Y location of the tile (the bit inside the row)
+
+        @return  (int) returns 1 if the bit of the tile is set, 0 if not
+*/
+int
+getBitboardTile (Bitboard * pBitboard, int nXLocation, int nYLocation)
+{
+        return (int) ((pBitboard->ullarrRows[nXLocation] >> nYLocation) & 1ULL);
+}
+
+/* This function gives the mask of the bits that are inside the playing grid for a single row
+        @param   (int)  nGridSize is the size of the playing grid
+
+        @return  (unsigned long long) a row with only the first nGridSize bits set
+*/
+unsigned long long
+getBitboardRowMask (int nGridSize)
+{
+        //Shifting a 64-bit word by 64 is undefined, so the full row is handled separately
+        if (nGridSize >= BITBOARD_MAX_GRID_SIZE)
+                return ~0ULL;
+        else
+                return (1ULL << nGridSize) - 1ULL;
+}
+
+/* This function counts the number of set bits in a row of the bitboard
+        @param   (unsigned long long)  ullRow is the row to count
+
+        @return  (int) the number of set bits in the row
+*/
+int
+countBitboardRowBits (unsigned long long ullRow)
+{
+#ifdef __GNUC__
+        return __builtin_popcountll (ullRow);
+#else
+        //Clear the lowest set bit until the row is empty
+        int nCount = 0;
+
+        while (ullRow)
+        {
+                ullRow &= ullRow - 1ULL;
+                nCount++;
+        }
+
+        return nCount;
+#endif
+}
+
+/* This function counts the number of set bits in the whole bitboard
+        @param   (Bitboard *)  pBitboard is the pointer to the selected bitboard
+
+        @return  (int) the number of set bits in the bitboard
+*/
+int
+countBitboardTiles (Bitboard * pBitboard)
+{
+        int nCount = 0;
+        int i;
+
+        for (i = 0; i < pBitboard->nGridSize; i++)
+        {
+                nCount += countBitboardRowBits (pBitboard->ullarrRows[i]);
+        }
+
+        return nCount;
+}
+
+/* This function gives the index of the lowest set bit in a row of the bitboard
+        @param   (unsigned long long)  ullRow is the row to check
+
+        @return  (int) the index of the lowest set bit, -1 if the row is empty
+*/
+int
+getLowestBitboardRowBit (unsigned long long ullRow)
+{
+        if (ullRow == 0)
+                return -1;
+
+#ifdef __GNUC__
+        return __builtin_ctzll (ullRow);
+#else
+        int nIndex = 0;
+
+        while (!(ullRow & 1ULL))
+        {
+                ullRow >>= 1;
+                nIndex++;
+        }
+
+        return nIndex;
+#endif
+}
+
+/* This function builds a bitboard out of a grid of integer tiles. Only the tiles with positive values are set.
+        @param   (Bitboard *)  pBitboard is the pointer to the bitboard to build
+        @param   (int *)  pTiles is the pointer to the grid of tiles (Ex: narrSensedTiles)
+        @param   (int)  nGridSize is the size of the playing grid
+
+        @return  (void) no return value
+*/
+void
+buildBitboardFromTiles (Bitboard * pBitboard, int * pTiles, int nGridSize)
+{
+        int i, j;
+
+        clearBitboard (pBitboard, nGridSize);
+
+        for (i = 0; i < nGridSize; i++)
+        {
+                unsigned long long ullRow = 0;
+
+                for (j = 0; j < nGridSize; j++)
+                {
+                        if (*(pTiles + i * nGridSize + j) > 0)
+                                ullRow |= (1ULL << j);
+                }
+
+                pBitboard->ullarrRows[i] = ullRow;
+        }
+}
+
+/* This function expands the wavefront of a flood fill by one step in every direction (UP, DOWN, LEFT, RIGHT).
+
+        Instead of visiting each tile, the whole row is shifted left and right to reach the adjacent tiles of the same row,
+        while the rows above and below are simply OR'ed in. The new wavefront only keeps the walkable tiles that have not
+        been reached yet.
+
+        @param   (Bitboard *)  pWalkable is the pointer to the bitboard of the walkable tiles
+        @param   (Bitboard *)  pReached is the pointer to the bitboard of the tiles already reached by the flood fill
+        @param   (Bitboard *)  pWavefront is the pointer to the current wavefront, replaced by the next wavefront
+
+        @return  (int) returns 1 if the new wavefront still has tiles in it, 0 if the flood fill is done
+*/
+int
+expandBitboardWavefront (Bitboard * pWalkable, Bitboard * pReached, Bitboard * pWavefront)
+{
+        int nGridSize = pWalkable->nGridSize;
+        unsigned long long ullarrNextRows[BITBOARD_MAX_GRID_SIZE];
+        unsigned long long ullHasTiles = 0;
+        int i;
+
+        for (i = 0; i < nGridSize; i++)
+        {
+                //Spread the tiles of the current row to the left and to the right
+                unsigned long long ullCurrentRow = pWavefront->ullarrRows[i];
+                unsigned long long ullSpread = ullCurrentRow | (ullCurrentRow << 1) | (ullCurrentRow >> 1);
+
+                //Spread the tiles of the rows above and below into the current row
+                if (i > 0)
+                        ullSpread |= pWavefront->ullarrRows[i - 1];
+                if (i < nGridSize - 1)
+                        ullSpread |= pWavefront->ullarrRows[i + 1];
+
+                //Only keep the walkable tiles that have not been reached before
+                ullarrNextRows[i] = ullSpread & pWalkable->ullarrRows[i] & ~pReached->ullarrRows[i];
+        }
+
+        //Save the new wavefront and mark its tiles as reached
+        for (i = 0; i < nGridSize; i++)
+        {
+                pWavefront->ullarrRows[i] = ullarrNextRows[i];
+                pReached->ullarrRows[i] |= ullarrNextRows[i];
+                ullHasTiles |= ullarrNextRows[i];
+        }
+
+        return ullHasTiles != 0;
+}
+
+/* This function checks whether or not a tile can be reached from a starting point by only walking on walkable tiles.
+   The starting point itself does not need to be walkable.
+        @param   (Bitboard *)  pWalkable is the pointer to the bitboard of the walkable tiles
+        @param   (int)  nStartXLocation is the X location of the starting point
+        @param   (int)  nStartYLocation is the Y location of the starting point
+        @param   (int)  nTargetXLocation is the X location of the target tile
+        @param   (int)  nTargetYLocation is the Y location of the target tile
+
+        @return  (int) returns 1 if the target tile can be reached, 0 if not
+*/
+int
+isBitboardTileReachable (Bitboard * pWalkable,
+                        int nStartXLocation,
+                        int nStartYLocation,
+                        int nTargetXLocation,
+                        int nTargetYLocation)
+{
+        Bitboard Reached, Wavefront;
+
+        //The flood fill starts at the starting point
+        clearBitboard (&Reached, pWalkable->nGridSize);
+        clearBitboard (&Wavefront, pWalkable->nGridSize);
+        setBitboardTile (&Reached, nStartXLocation, nStartYLocation, 1);
+        setBitboardTile (&Wavefront, nStartXLocation, nStartYLocation, 1);
+
+        if (nStartXLocation == nTargetXLocation && nStartYLocation == nTargetYLocation)
+                return 1;
+
+        //Keep expanding until the target has been reached or until there is nowhere else to go
+        while (expandBitboardWavefront (pWalkable, &Reached, &Wavefront))
+        {
+                if (getBitboardTile (&Reached, nTargetXLocation, nTargetYLocation))
+                        return 1;
+        }
+
+        return 0;
+}
+
+/* This function computes the walking distance of every tile from a starting point using a bit-parallel flood fill.
+   Each expansion of the wavefront is one BFS distance layer.
+        @param   (Bitboard *)  pWalkable is the pointer to the bitboard of the walkable tiles
+        @param   (int)  nStartXLocation is the X location of the starting point
+        @param   (int)  nStartYLocation is the Y location of the starting point
+        @param   (int *)  pDistances is the pointer to a nGridSize x nGridSize grid that will contain the distances
+                (-1 if the tile cannot be reached)
+
+        @return  (int) the number of tiles that were reached, including the starting point
+*/
+int
+computeBitboardDistances (Bitboard * pWalkable, int nStartXLocation, int nStartYLocation, int * pDistances)
+{
+        int nGridSize = pWalkable->nGridSize;
+        Bitboard Reached, Wavefront;
+        int nDistance = 0;
+        int nNumOfReachedTiles = 1;
+        int i;
+
+        for (i = 0; i < nGridSize * nGridSize; i++)
+        {
+                pDistances[i] = -1;
+        }
+
+        //The flood fill starts at the starting point
+        clearBitboard (&Reached, nGridSize);
+        clearBitboard (&Wavefront, nGridSize);
+        setBitboardTile (&Reached, nStartXLocation, nStartYLocation, 1);
+        setBitboardTile (&Wavefront, nStartXLocation, nStartYLocation, 1);
+        *(pDistances + nStartXLocation * nGridSize + nStartYLocation) = 0;
+
+        //Every expansion of the wavefront is one step further away from the starting point
+        while (expandBitboardWavefront (pWalkable, &Reached, &Wavefront))
+        {
+                nDistance++;
+
+                //Save the distance of each tile of the new wavefront
+                for (i = 0; i < nGridSize; i++)
+                {
+                        unsigned long long ullRow = Wavefront.ullarrRows[i];
+
+                        while (ullRow)
+                        {
+                                int j = getLowestBitboardRowBit (ullRow);
+
+                                *(pDistances + i * nGridSize + j) = nDistance;
+                                nNumOfReachedTiles++;
+
+                                //Clear the lowest set bit
+                                ullRow &= ullRow - 1ULL;
+                        }
+                }
+        }
+
+        return nNumOfReachedTiles;
+}
@@ -0,0 +1,47 @@
+/*
+* Programmed By: Aaron Gabrielle Dichoso
+*
+* Description:
+* 	BitboardSystem_prototype.h: Contains the function prototypes of BitboardSystem.c
+*
+* Last Modified: 19/10/2026
+*/
+
+//A single 64-bit word is enough to hold an entire row of the biggest playing grid
+#define BITBOARD_MAX_GRID_SIZE 64
+
+typedef struct
+{
+  unsigned long long ullarrRows[BITBOARD_MAX_GRID_SIZE];
+  int nGridSize;
+
+} Bitboard;
+
+void                    clearBitboard                   (Bitboard * pBitboard,
+                                                        int nGridSize);
+void                    setBitboardTile                 (Bitboard * pBitboard,
+                                                        int nXLocation,
+                                                        int nYLocation,
+                                                        int nIsSet);
+int                     getBitboardTile                 (Bitboard * pBitboard,
+                                                        int nXLocation,
+                                                        int nYLocation);
+unsigned long long      getBitboardRowMask              (int nGridSize);
+int                     countBitboardRowBits            (unsigned long long ullRow);
+int                     countBitboardTiles              (Bitboard * pBitboard);
+int                     getLowestBitboardRowBit         (unsigned long long ullRow);
+void                    buildBitboardFromTiles          (Bitboard * pBitboard,
+                                                        int * pTiles,
+                                                        int nGridSize);
+int                     expandBitboardWavefront         (Bitboard * pWalkable,
+                                                        Bitboard * pReached,
+                                                        Bitboard * pWavefront);
+int                     isBitboardTileReachable         (Bitboard * pWalkable,
+                                                        int nStartXLocation,
+                                                        int nStartYLocation,
+                                                        int nTargetXLocation,
+                                                        int nTargetYLocation);
+int                     computeBitboardDistances        (Bitboard * pWalkable,
+                                                        int nStartXLocation,
+                                                        int nStartYLocation,
+                                                        int * pDistances);
@@ -0,0 +1,214 @@
+/*
+* Programmed By: Aaron Gabrielle Dichoso
+*
+* Description:
+* 	CostScanSystem.c: A cost scanning system to be used for the Machine Project.
+*       Finds the open tile with the lowest F cost during A* path generation. When the processor supports AVX2,
+*       8 tiles are compared with a single instruction instead of one tile at a time.
+*
+* Last Modified: 19/10/2026
+* Acknowledgements:
+*       Intel Intrinsics Guide - https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html
+*       Function multiversioning - https://gcc.gnu.org/onlinedocs/gcc/x86-Function-Attributes.html
+*       __builtin_cpu_supports - https://gcc.gnu.org/onlinedocs/gcc/x86-Built-in-Functions.html
+*/
+
+#include <limits.h>
+#include "CostScanSystem_prototype.h"
+
+#if COST_SCAN_HAS_AVX2
+#include <immintrin.h>
+#endif
+
+/* This function checks the tiles one at a time to find the tile with the lowest F cost (G cost + H cost).
+   Only the open tiles with an F cost of at least 0 are checked. If multiple tiles have the same lowest F cost,
+   the one with the lowest H cost is taken. If they also have the same H cost, the tile checked last is taken.
+
+   The lowest costs found so far are passed in so that the scan can continue from where another scan stopped.
+
+        @param   (int *)  pGCosts is the pointer to the G costs of every tile
+        @param   (int *)  pHCosts is the pointer to the H costs of every tile
+        @param   (int *)  pOpenTiles is the pointer to the state of every tile (Ex: narrViewedTiles)
+        @param   (int)  nOpenValue is the state of the tiles that can be picked
+        @param   (int)  nStartIndex is the index of the first tile to check
+        @param   (int)  nNumOfTiles is the total number of tiles
+        @param   (int *)  pLowestFCost is the pointer to the lowest F cost found so far
+        @param   (int *)  pLowestHCost is the pointer to the H cost of the tile with the lowest F cost found so far
+        @param   (int)  nLowestIndex is the index of the tile with the lowest F cost found so far (-1 if none)
+
+        @return  (int) the index of the tile with the lowest F cost, -1 if there are no open tiles
+*/
+int
+scanLowestFCostTiles (int * pGCosts,
+                        int * pHCosts,
+                        int * pOpenTiles,
+                        int nOpenValue,
+                        int nStartIndex,
+                        int nNumOfTiles,
+                        int * pLowestFCost,
+                        int * pLowestHCost,
+                        int nLowestIndex)
+{
+        int i;
+
+        for (i = nStartIndex; i < nNumOfTiles; i++)
+        {
+                int nCurrentHCost = pHCosts[i];
+                int nCurrentFCost = pGCosts[i] + nCurrentHCost;
+
+                if (nCurrentFCost >= 0 && pOpenTiles[i] == nOpenValue){
+                        //Take the tile if it has a lower F cost, or the same F cost with a lower or equal H cost
+                        if (nCurrentFCost < *pLowestFCost ||
+                           (nCurrentFCost == *pLowestFCost && nCurrentHCost <= *pLowestHCost)){
+                                *pLowestFCost = nCurrentFCost;
+                                *pLowestHCost = nCurrentHCost;
+                                nLowestIndex = i;
+                        }
+                }
+        }
+
+        return nLowestIndex;
+}
+
+#if COST_SCAN_HAS_AVX2
+/* This function does the same scan as scanLowestFCostTiles, but checks 8 tiles at the same time using AVX2.
+
+   Each of the 8 lanes keeps its own lowest costs and index, using the same rules as the one tile at a time scan.
+   Since every lane sees its tiles in order, each lane ends with the LAST tile that has its lowest costs.
+   The 8 lanes are then combined: the lowest F cost wins, then the lowest H cost, then the highest index,
+   which is exactly the tile the one tile at a time scan would have picked. The leftover tiles are checked one at a time.
+
+        @param   (int *)  pGCosts is the pointer to the G costs of every tile
+        @param   (int *)  pHCosts is the pointer to the H costs of every tile
+        @param   (int *)  pOpenTiles is the pointer to the state of every tile (Ex: narrViewedTiles)
+        @param   (int)  nOpenValue is the state of the tiles that can be picked
+        @param   (int)  nNumOfTiles is the total number of tiles
+
+        @return  (int) the index of the tile with the lowest F cost, -1 if there are no open tiles
+*/
+__attribute__ ((target ("avx2")))
+static int
+scanLowestFCostTilesAVX2 (int * pGCosts, int * pHCosts, int * pOpenTiles, int nOpenValue, int nNumOfTiles)
+{
+        int narrLaneFCosts[COST_SCAN_AVX2_LANES];
+        int narrLaneHCosts[COST_SCAN_AVX2_LANES];
+        int narrLaneIndexes[COST_SCAN_AVX2_LANES];
+
+        int nLowestFCost = INT_MAX;
+        int nLowestHCost = INT_MAX;
+        int nLowestIndex = -1;
+        int i;
+
+        __m256i LowestFCosts = _mm256_set1_epi32 (INT_MAX);
+        __m256i LowestHCosts = _mm256_set1_epi32 (INT_MAX);
+        __m256i LowestIndexes = _mm256_set1_epi32 (-1);
+
+        __m256i OpenValue = _mm256_set1_epi32 (nOpenValue);
+        __m256i MinusOne = _mm256_set1_epi32 (-1);
+        __m256i Indexes = _mm256_setr_epi32 (0, 1, 2, 3, 4, 5, 6, 7);
+        __m256i Step = _mm256_set1_epi32 (COST_SCAN_AVX2_LANES);
+
+        for (i = 0; i + COST_SCAN_AVX2_LANES <= nNumOfTiles; i += COST_SCAN_AVX2_LANES)
+        {
+                __m256i HCosts = _mm256_loadu_si256 ((__m256i *) (pHCosts + i));
+                __m256i FCosts = _mm256_add_epi32 (_mm256_loadu_si256 ((__m256i *) (pGCosts + i)), HCosts);
+                __m256i OpenTiles = _mm256_loadu_si256 ((__m256i *) (pOpenTiles + i));
+
+                //Only the open tiles with an F cost of at least 0 can be picked
+                __m256i IsPickable = _mm256_and_si256 (_mm256_cmpeq_epi32 (OpenTiles, OpenValue),
+                                                        _mm256_cmpgt_epi32 (FCosts, MinusOne));
+
+                //Lower F cost, or the same F cost with a lower or equal H cost (not greater)
+                __m256i IsLowerFCost = _mm256_cmpgt_epi32 (LowestFCosts, FCosts);
+                __m256i IsSameFCost = _mm256_cmpeq_epi32 (LowestFCosts, FCosts);
+                __m256i IsGreaterHCost = _mm256_cmpgt_epi32 (HCosts, LowestHCosts);
+                __m256i IsLower = _mm256_or_si256 (IsLowerFCost, _mm256_andnot_si256 (IsGreaterHCost, IsSameFCost));
+
+                __m256i ShouldUpdate = _mm256_and_si256 (IsPickable, IsLower);
+
+                LowestFCosts = _mm256_blendv_epi8 (LowestFCosts, FCosts, ShouldUpdate);
+                LowestHCosts = _mm256_blendv_epi8 (LowestHCosts, HCosts, ShouldUpdate);
+                LowestIndexes = _mm256_blendv_epi8 (LowestIndexes, Indexes, ShouldUpdate);
+
+                Indexes = _mm256_add_epi32 (Indexes, Step);
+        }
+
+        _mm256_storeu_si256 ((__m256i *) narrLaneFCosts, LowestFCosts);
+        _mm256_storeu_si256 ((__m256i *) narrLaneHCosts, LowestHCosts);
+        _mm256_storeu_si256 ((__m256i *) narrLaneIndexes, LowestIndexes);
+
+        //Combine the lanes, the highest index wins if the F and H costs are the same
+        int nLane;
+
+        for (nLane = 0; nLane < COST_SCAN_AVX2_LANES; nLane++)
+        {
+                int nLaneFCost = narrLaneFCosts[nLane];
+                int nLaneHCost = narrLaneHCosts[nLane];
+                int nLaneIndex = narrLaneIndexes[nLane];
+
+                if (nLaneIndex == -1)
+                        continue;
+
+                if (nLowestIndex == -1 ||
+                    nLaneFCost < nLowestFCost ||
+                   (nLaneFCost == nLowestFCost && nLaneHCost < nLowestHCost) ||
+                   (nLaneFCost == nLowestFCost && nLaneHCost == nLowestHCost && nLaneIndex > nLowestIndex)){
+                        nLowestFCost = nLaneFCost;
+                        nLowestHCost = nLaneHCost;
+                        nLowestIndex = nLaneIndex;
+                }
+        }
+
+        //The leftover tiles all come after the tiles in the lanes, so the one at a time scan can simply continue
+        return scanLowestFCostTiles (pGCosts,
+                                        pHCosts,
+                                        pOpenTiles,
+                                        nOpenValue,
+                                        i,
+                                        nNumOfTiles,
+                                        &nLowestFCost,
+                                        &nLowestHCost,
+                                        nLowestIndex);
+}
+#endif
+
+/* This function finds the open tile with the lowest F cost (G cost + H cost) out of every tile of the playing grid.
+   If multiple tiles have the same lowest F cost, the one with the lowest H cost is taken. If they also have the same H cost,
+   the last tile is taken. The AVX2 scan is used when the processor supports it.
+        @param   (int *)  pGCosts is the pointer to the G costs of every tile (Ex: narrGCosts)
+        @param   (int *)  pHCosts is the pointer to the H costs of every tile (Ex: narrHCosts)
+        @param   (int *)  pOpenTiles is the pointer to the state of every tile (Ex: narrViewedTiles)
+        @param   (int)  nOpenValue is the state of the tiles that can be picked
+        @param   (int)  nNumOfTiles is the total number of tiles
+
+        @return  (int) the index of the tile with the lowest F cost, -1 if there are no open tiles
+*/
+int
+findLowestFCostTile (int * pGCosts, int * pHCosts, int * pOpenTiles, int nOpenValue, int nNumOfTiles)
+{
+        int nLowestFCost = INT_MAX;
+        int nLowestHCost = INT_MAX;
+
+#if COST_SCAN_HAS_AVX2
+        //Check only once if the processor supports AVX2
+        static int nHasAVX2 = -1;
+
+        if (nHasAVX2 == -1){
+                __builtin_cpu_init ();
+                nHasAVX2 = __builtin_cpu_supports ("avx2") ? 1 : 0;
+        }
+
+        if (nHasAVX2)
+                return scanLowestFCostTilesAVX2 (pGCosts, pHCosts, pOpenTiles, nOpenValue, nNumOfTiles);
+#endif
+
+        return scanLowestFCostTiles (pGCosts,
+                                        pHCosts,
+                                        pOpenTiles,
+                                        nOpenValue,
+                                        0,
+                                        nNumOfTiles,
+                                        &nLowestFCost,
+                                        &nLowestHCost,
+                                        -1);
+}
@@ -0,0 +1,33 @@
+/*
+* Programmed By: Aaron Gabrielle Dichoso
+*
+* Description:
+* 	CostScanSystem_prototype.h: Contains the function prototypes of CostScanSystem.c
+*
+* Last Modified: 19/10/2026
+*/
+
+//Only GCC compatible x86 compilers can build the AVX2 scan, every other compiler uses the portable scan
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define COST_SCAN_HAS_AVX2 1
+#else
+#define COST_SCAN_HAS_AVX2 0
+#endif
+
+//Number of tiles checked by a single AVX2 instruction (8 integers of 32 bits)
+#define COST_SCAN_AVX2_LANES 8
+
+int     findLowestFCostTile             (int * pGCosts,
+                                        int * pHCosts,
+                                        int * pOpenTiles,
+                                        int nOpenValue,
+                                        int nNumOfTiles);
+int     scanLowestFCostTiles            (int * pGCosts,
+                                        int * pHCosts,
+                                        int * pOpenTiles,
+                                        int nOpenValue,
+                                        int nStartIndex,
+                                        int nNumOfTiles,
+                                        int * pLowestFCost,
+                                        int * pLowestHCost,
+                                        int nLowestIndex);
@@ -4,7 +4,7 @@
 * Description:
 * 	GUIFunctions.c: Contains mostly all of the functions used for the GUI of the application.
 *
-* Last Modified: 04/02/2022
+* Last Modified: 19/10/2026
 */
 
 #include "SoundSystem.c"
@@ -247,6 +247,153 @@ displayStats (int nNumOfSenses, int nNumOfRotations, int nNumOfMovements)
         printf ("\n");
 }
 
+/* This function displays the minimum number of actions needed to win the board with full knowledge of every tile,
+   and how many times more actions LRRH took than that (the competitive ratio)
+        @param   (int)  nNumOfActions is the total number of senses, rotations, and movements done by LRRH
+        @param   (int)  nOptimalNumOfActions is the minimum number of actions needed to win (-1 if the board cannot be won)
+        @param   (int)  nHasWon tells whether or not LRRH has won the game
+
+        @return  (void) no return value
+*/
+void
+displayCompetitiveRatio (int nNumOfActions, int nOptimalNumOfActions, int nHasWon)
+{
+	printf ("\n");
+	displayDivider ();
+
+        if (nOptimalNumOfActions == -1)
+                printf ("\n| Optimal Actions: none, the board cannot be won |\n");
+        else if (nHasWon)
+                printf ("\n| Optimal Actions: %d | Competitive Ratio: %.2f |\n", nOptimalNumOfActions, (double) nNumOfActions / nOptimalNumOfActions);
+        else
+                printf ("\n| Optimal Actions: %d | Competitive Ratio: - |\n", nOptimalNumOfActions);
+
+	displayDivider ();
+        printf ("\n");
+}
+
+/* This function displays the exact chance of winning and the expected number of turns of random mode,
+   solved from the Markov chain of the playing grid before the game started
+        @param   (double)  dWinProbability is the chance of LRRH winning (0 to 1)
+        @param   (double)  dExpectedNumOfTurns is the expected number of turns until the game ends
+        @param   (int)  nNumOfIterations is the number of sweeps the solver needed (-1 if it did not converge)
+
+        @return  (void) no return value
+*/
+void
+displayRandomModeAnalysis (double dWinProbability, double dExpectedNumOfTurns, int nNumOfIterations)
+{
+	printf ("\n");
+	displayDivider ();
+
+        if (nNumOfIterations == -1)
+                printf ("\n| Win Chance: unknown, the Markov chain solver did not converge |\n");
+        else
+                printf ("\n| Win Chance: %.4f%% | Expected Turns: %.1f |\n", dWinProbability * 100, dExpectedNumOfTurns);
+
+	displayDivider ();
+        printf ("\n");
+}
+
+/* This function displays the results of the games of random mode that were simulated on the same board
+        @param   (int)  nNumOfGames is the number of games simulated
+        @param   (int)  nNumOfWins is the number of simulated games LRRH won
+        @param   (long long)  llTotalNumOfTurns is the total number of turns of every simulated game
+
+        @return  (void) no return value
+*/
+void
+displayBatchSimulation (int nNumOfGames, int nNumOfWins, long long llTotalNumOfTurns)
+{
+	printf ("\n");
+	displayDivider ();
+        printf ("\n| Simulated Games: %d | Win Rate: %.4f%% | Average Turns: %.1f |\n", 
+                nNumOfGames, 
+                100.0 * nNumOfWins / nNumOfGames, 
+                (double) llTotalNumOfTurns / nNumOfGames);
+	displayDivider ();
+        printf ("\n");
+}
+
+/* This function displays a message saying that random mode was stopped after taking too many turns
+        @param   (int)  nTurnLimit is the number of turns random mode can take
+
+        @return  (void) no return value
+*/
+void
+displayTurnLimitMessage (int nTurnLimit)
+{
+	printf ("\n");
+	displayDivider ();
+        printf ("\n| LRRH has wandered for %d turns without reaching an ending, so the game was stopped. |\n", nTurnLimit);
+	displayDivider ();
+        printf ("\n");
+}
+
+/* This function displays a message saying that random mode was stopped since none of the endings can be reached anymore
+
+        @return  (void) no return value
+*/
+void
+displayNoEndingMessage ()
+{
+	printf ("\n");
+	displayDivider ();
+        printf ("\n| LRRH can no longer reach any ending from where she is, so the game was stopped. |\n");
+	displayDivider ();
+        printf ("\n");
+}
+
+/* This function displays what smart mode was doing when it was stopped for going around without making progress,
+   so the board and the queue that caused it can be looked into
+        @param   (int)  nNumOfIdleIterations is the number of times in a row the game loop went around without progress
+        @param   (int)  nLRRHXLocation is LRRH's X Location
+        @param   (int)  nLRRHYLocation is LRRH's Y Location
+        @param   (char)  cLRRHViewDirection is LRRH's viewing direction
+        @param   (int)  nHasFlower tells whether or not LRRH has gone to a flower field
+        @param   (int)  nHasBread tells whether or not LRRH has bread
+        @param   (int)  nVisitedWoodsman tells whether or not LRRH has visited the woodsman's house
+        @param   (int)  nNumOfSensedTiles is the number of tiles LRRH has sensed
+        @param   (int)  nNumOfWalkedTiles is the number of tiles LRRH has walked on
+        @param   (Queue *)  pXGridQueue is the pointer to the X coordinates still in the queue
+        @param   (Queue *)  pYGridQueue is the pointer to the Y coordinates still in the queue
+
+        @return  (void) no return value
+*/
+void
+displayNoProgressDiagnostics (int nNumOfIdleIterations, 
+                                int nLRRHXLocation, 
+                                int nLRRHYLocation, 
+                                char cLRRHViewDirection, 
+                                int nHasFlower, 
+                                int nHasBread, 
+                                int nVisitedWoodsman, 
+                                int nNumOfSensedTiles, 
+                                int nNumOfWalkedTiles, 
+                                Queue * pXGridQueue, 
+                                Queue * pYGridQueue)
+{
+        int i;
+
+	printf ("\n");
+	displayDivider ();
+        printf ("\n| Smart mode went around %d times without LRRH sensing, walking on, or getting anything new, so the game was stopped. |\n", 
+                nNumOfIdleIterations);
+        printf ("| Location: (%d, %d) | Facing: %s |\n", nLRRHXLocation + 1, nLRRHYLocation + 1, directionSymbolToName (cLRRHViewDirection));
+        printf ("| Flower: %c | Bread: %c | Woodsman: %c |\n", nHasFlower ? 'Y' : 'N', nHasBread ? 'Y' : 'N', nVisitedWoodsman ? 'Y' : 'N');
+        printf ("| Sensed Tiles: %d | Walked Tiles: %d |\n", nNumOfSensedTiles, nNumOfWalkedTiles);
+        printf ("| Queue (%d):", pXGridQueue->nCount);
+
+        for (i = 0; i < pXGridQueue->nCount; i++)
+        {
+                printf (" (%d, %d)", pXGridQueue->pArray[i] + 1, pYGridQueue->pArray[i] + 1);
+        }
+
+        printf (" |\n");
+	displayDivider ();
+        printf ("\n");
+}
+
 /* This function displays a legend to guide the user which elements on the play grid are which.
 
         @return  (void) no return value
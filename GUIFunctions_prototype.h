@@ -4,7 +4,7 @@
 * Description:
 * 	GUIFunctions_prototype.h: Contains the function prototypes of GUIFunctions.c
 *
-* Last Modified: 28/01/2022
+* Last Modified: 19/10/2026
 */
 
 const char *    directionSymbolToName                   (char cSymbol);
@@ -29,6 +29,28 @@ void            displayPlayAndPathGrid                  (char * pPlayGrid,
 void            displayStats                            (int nNumOfRotations, 
                                                         int nNumOfMovements, 
                                                         int nNumOfSenses);
+void            displayCompetitiveRatio                 (int nNumOfActions, 
+                                                        int nOptimalNumOfActions, 
+                                                        int nHasWon);
+void            displayRandomModeAnalysis               (double dWinProbability, 
+                                                        double dExpectedNumOfTurns, 
+                                                        int nNumOfIterations);
+void            displayBatchSimulation                  (int nNumOfGames, 
+                                                        int nNumOfWins, 
+                                                        long long llTotalNumOfTurns);
+void            displayTurnLimitMessage                 (int nTurnLimit);
+void            displayNoEndingMessage                  ();
+void            displayNoProgressDiagnostics            (int nNumOfIdleIterations, 
+                                                        int nLRRHXLocation, 
+                                                        int nLRRHYLocation, 
+                                                        char cLRRHViewDirection, 
+                                                        int nHasFlower, 
+                                                        int nHasBread, 
+                                                        int nVisitedWoodsman, 
+                                                        int nNumOfSensedTiles, 
+                                                        int nNumOfWalkedTiles, 
+                                                        Queue * pXGridQueue, 
+                                                        Queue * pYGridQueue);
 void            displayLegend                           ();
 void            displayMovementMessage                  (char cSymbol);
 void            displaySenseMessage                     (char cSymbol);
@@ -0,0 +1,269 @@
+/*
+* Programmed By: Aaron Gabrielle Dichoso
+*
+* Description:
+* 	GameSystem.c: A game system to be used for the Machine Project.
+*       Plays a game of random mode one action at a time. Everything a game needs is kept in its RandomGame, so a host
+*       can keep many games at once on one thread, step them in any order, and pause or continue any of them.
+*       Nothing is displayed here, the host decides what to show after each step.
+*
+* Last Modified: 19/10/2026
+*/
+
+#include "GameSystem_prototype.h"
+
+/* This function gives the symbol of LRRH on the playing grid when she is facing a direction
+        @param   (char)  cDirection is the direction LRRH is facing (Ex: DIRECTION_SOUTH)
+
+        @return  (char) the symbol of LRRH (Ex: LRRH_DIRECTION_SOUTH)
+*/
+char
+convertDirectionToLRRHSymbol (char cDirection)
+{
+	switch (cDirection){
+	case DIRECTION_NORTH:
+		return LRRH_DIRECTION_NORTH;
+	case DIRECTION_EAST:
+		return LRRH_DIRECTION_EAST;
+	case DIRECTION_WEST:
+		return LRRH_DIRECTION_WEST;
+	default:
+		return LRRH_DIRECTION_SOUTH;
+	}
+}
+
+/* This function starts a game of random mode on its own copy of a playing grid
+        @param   (RandomGame *)  pGame is the pointer to the game to start
+        @param   (char *)  pPlayGrid is the pointer to carrPlayGrid (after every object has been placed)
+        @param   (int)  nGridSize is the size of the playing grid
+        @param   (int)  nStartXLocation is the X location LRRH starts at
+        @param   (int)  nStartYLocation is the Y location LRRH starts at
+        @param   (char)  cStartDirection is the direction LRRH starts facing (Ex: DIRECTION_SOUTH)
+        @param   (RandomGenerator *)  pRandomGenerator is the pointer to the random numbers the game starts with (it is copied)
+        @param   (int)  nTurnLimit is the number of turns the game can take before it is stopped (0 for no limit)
+
+        @return  (void) no return value
+*/
+void
+initRandomGame (RandomGame * pGame,
+                char * pPlayGrid,
+                int nGridSize,
+                int nStartXLocation,
+                int nStartYLocation,
+                char cStartDirection,
+                RandomGenerator * pRandomGenerator,
+                int nTurnLimit)
+{
+        pGame->nLRRHXLocation = nStartXLocation;
+        pGame->nLRRHYLocation = nStartYLocation;
+        pGame->cLRRHViewDirection = cStartDirection;
+        pGame->cPreviousWalkedTileValue = EMPTY_TILE;
+
+        pGame->nHasFlower = 0;
+        pGame->nHasBread = 0;
+        pGame->nVisitedWoodsman = 0;
+        pGame->nWasBreadTaken = 0;
+
+        pGame->nNumOfSenses = 0;
+        pGame->nNumOfRotations = 0;
+        pGame->nNumOfMovements = 0;
+        pGame->nNumOfTurns = 0;
+
+        pGame->nLastAction = GAME_ACTION_NONE;
+        pGame->cLastTile = EMPTY_TILE;
+        pGame->nOutcome = GAME_OUTCOME_RUNNING;
+        pGame->nStopReason = GAME_STOP_NONE;
+
+        pGame->nGridSize = nGridSize;
+        pGame->pPlayGrid = malloc (nGridSize * nGridSize);
+        memcpy (pGame->pPlayGrid, pPlayGrid, nGridSize * nGridSize);
+
+        pGame->pCanEndStates = malloc (nGridSize * nGridSize * NUM_OF_DIRECTIONS * ANALYSIS_NUM_OF_ITEM_SETS);
+        markEndingAnalysisStates (pGame->pPlayGrid, nStartXLocation, nStartYLocation, nGridSize, pGame->pCanEndStates);
+
+        pGame->nTurnLimit = nTurnLimit;
+        pGame->Generator = *pRandomGenerator;
+
+        //The game may not be able to end from the start
+        checkRandomGameStop (pGame);
+}
+
+/* This function frees the memory used by a game
+        @param   (RandomGame *)  pGame is the pointer to the game
+
+        @return  (void) no return value
+*/
+void
+clearRandomGame (RandomGame * pGame)
+{
+        free (pGame->pPlayGrid);
+        free (pGame->pCanEndStates);
+        pGame->pPlayGrid = NULL;
+        pGame->pCanEndStates = NULL;
+}
+
+/* This function stops a game that is still running if it can never end from LRRH's state, or if it has taken
+   as many turns as its turn limit
+        @param   (RandomGame *)  pGame is the pointer to the game
+
+        @return  (void) no return value
+*/
+void
+checkRandomGameStop (RandomGame * pGame)
+{
+        if (pGame->nOutcome != GAME_OUTCOME_RUNNING)
+                return;
+
+        int nItemFlags = (pGame->nHasFlower ? ANALYSIS_FLAG_FLOWER : 0) |
+                        (pGame->nHasBread ? ANALYSIS_FLAG_BREAD : 0) |
+                        (pGame->nVisitedWoodsman ? ANALYSIS_FLAG_WOODSMAN : 0);
+        int nState = encodeAnalysisState (pGame->nLRRHXLocation,
+                                                pGame->nLRRHYLocation,
+                                                convertDirectionSymbolToIndex (pGame->cLRRHViewDirection),
+                                                nItemFlags,
+                                                pGame->nGridSize);
+
+        if (!pGame->pCanEndStates[nState]){
+                pGame->nOutcome = GAME_OUTCOME_STOPPED;
+                pGame->nStopReason = GAME_STOP_NO_ENDING;
+        } else if (pGame->nTurnLimit > 0 && pGame->nNumOfTurns >= pGame->nTurnLimit){
+                pGame->nOutcome = GAME_OUTCOME_STOPPED;
+                pGame->nStopReason = GAME_STOP_TURN_LIMIT;
+        }
+}
+
+/* This function picks a random action with the chances of random mode:
+        0 - 8: Rotate to the left
+        9 - 61: Move forward
+        62 - 67: Rotate to the right
+        68 - 100: Sense the tile she is facing
+        @param   (RandomGenerator *)  pGenerator is the pointer to the random numbers of the game
+
+        @return  (int) the GAME_ACTION picked (a forward movement even if LRRH is facing the edge of the playing grid)
+*/
+int
+chooseRandomAction (RandomGenerator * pGenerator)
+{
+        int nRandomNumber = generateRandomNumber (pGenerator, 0, RANDOM_ACTION_MAX_NUMBER);
+
+        if (nRandomNumber <= RANDOM_ROTATE_LEFT_MAX_NUMBER)
+                return GAME_ACTION_ROTATE_LEFT;
+        else if (nRandomNumber <= RANDOM_FORWARD_MAX_NUMBER)
+                return GAME_ACTION_FORWARD;
+        else if (nRandomNumber <= RANDOM_ROTATE_RIGHT_MAX_NUMBER)
+                return GAME_ACTION_ROTATE_RIGHT;
+        else
+                return GAME_ACTION_SENSE;
+}
+
+/* This function makes LRRH do one random action, with the same chances and rules as random mode
+   (a forward movement into the edge of the playing grid is a rotation to the right instead)
+        @param   (RandomGame *)  pGame is the pointer to the game
+
+        @return  (int) the GAME_ACTION LRRH did (a blocked forward movement gives GAME_ACTION_ROTATE_RIGHT),
+                or GAME_ACTION_NONE if the game has already ended
+*/
+int
+stepRandomGame (RandomGame * pGame)
+{
+        if (pGame->nOutcome != GAME_OUTCOME_RUNNING)
+                return GAME_ACTION_NONE;
+
+        int nGridSize = pGame->nGridSize;
+        int nAction = chooseRandomAction (&pGame->Generator);
+        char * pLRRHTile = pGame->pPlayGrid + pGame->nLRRHXLocation * nGridSize + pGame->nLRRHYLocation;
+
+        //The tile LRRH is facing
+        int nNextXLocation = pGame->nLRRHXLocation + convertDirectionSymbolToXMovement (pGame->cLRRHViewDirection);
+        int nNextYLocation = pGame->nLRRHYLocation + convertDirectionSymbolToYMovement (pGame->cLRRHViewDirection);
+        int nIsNextTileValid = isLocationValid (nNextXLocation, nNextYLocation, nGridSize - 1);
+
+        if (nAction == GAME_ACTION_FORWARD && !nIsNextTileValid)
+                nAction = GAME_ACTION_ROTATE_RIGHT;
+
+        pGame->nNumOfTurns++;
+        pGame->nLastAction = nAction;
+
+        switch (nAction){
+        case GAME_ACTION_ROTATE_LEFT:
+                pGame->cLRRHViewDirection = simulateLeftLRRHRotation (pGame->cLRRHViewDirection);
+                *pLRRHTile = convertDirectionToLRRHSymbol (pGame->cLRRHViewDirection);
+                pGame->nNumOfRotations++;
+                break;
+        case GAME_ACTION_ROTATE_RIGHT:
+                pGame->cLRRHViewDirection = simulateRightLRRHRotation (pGame->cLRRHViewDirection);
+                *pLRRHTile = convertDirectionToLRRHSymbol (pGame->cLRRHViewDirection);
+                pGame->nNumOfRotations++;
+                break;
+        case GAME_ACTION_SENSE:
+                //Facing the edge of the playing grid, there is nothing to sense
+                pGame->cLastTile = nIsNextTileValid ? *(pGame->pPlayGrid + nNextXLocation * nGridSize + nNextYLocation) : EMPTY_TILE;
+                pGame->nNumOfSenses++;
+                break;
+        case GAME_ACTION_FORWARD:
+                {
+                        char * pNextTile = pGame->pPlayGrid + nNextXLocation * nGridSize + nNextYLocation;
+                        char cMovedTileElement = *pNextTile;
+
+                        //Move LRRH into the new tile, and return the tile she leaves to what it was
+                        *pNextTile = *pLRRHTile;
+                        *pLRRHTile = pGame->cPreviousWalkedTileValue;
+
+                        pGame->nLRRHXLocation = nNextXLocation;
+                        pGame->nLRRHYLocation = nNextYLocation;
+                        pGame->cPreviousWalkedTileValue = cMovedTileElement;
+                        pGame->cLastTile = cMovedTileElement;
+                        pGame->nNumOfMovements++;
+
+                        switch (cMovedTileElement){
+                        case FLOWER_TILE:
+                                pGame->nHasFlower = 1;
+                                break;
+                        case BAKERY_TILE:
+                                pGame->nHasBread = 1;
+                                pGame->nWasBreadTaken = 0;
+                                break;
+                        case WOODSMAN_TILE:
+                                pGame->nVisitedWoodsman = 1;
+                                break;
+                        case WOLF_TILE:
+                                //The wolf only lets LRRH go if he can take her bread
+                                pGame->nWasBreadTaken = pGame->nHasBread;
+                                pGame->nHasBread = 0;
+                                break;
+                        }
+                }
+                break;
+        }
+
+        //Check whether or not the game has ended on the tile LRRH is standing on
+        char cTile = pGame->cPreviousWalkedTileValue;
+
+        if (cTile == PIT_TILE || (cTile == WOLF_TILE && !pGame->nWasBreadTaken))
+                pGame->nOutcome = GAME_OUTCOME_LOSS;
+        else if (cTile == GRANDMA_TILE)
+                pGame->nOutcome = (pGame->nHasFlower && pGame->nHasBread && pGame->nVisitedWoodsman) ? GAME_OUTCOME_WIN : GAME_OUTCOME_LOSS;
+        else
+                checkRandomGameStop (pGame);
+
+        return nAction;
+}
+
+/* This function makes LRRH do a number of random actions, stopping early if the game ends
+        @param   (RandomGame *)  pGame is the pointer to the game
+        @param   (int)  nNumOfSteps is the number of actions to do
+
+        @return  (int) the number of actions done
+*/
+int
+advanceRandomGame (RandomGame * pGame, int nNumOfSteps)
+{
+        int i = 0;
+
+        while (i < nNumOfSteps && stepRandomGame (pGame) != GAME_ACTION_NONE)
+        {
+                i++;
+        }
+
+        return i;
+}
@@ -0,0 +1,79 @@
+/*
+* Programmed By: Aaron Gabrielle Dichoso
+*
+* Description:
+* 	GameSystem_prototype.h: Contains the function prototypes of GameSystem.c
+*
+* Last Modified: 19/10/2026
+*/
+
+//Actions LRRH can take in a step of random mode (GAME_ACTION_NONE if the game has already ended)
+#define GAME_ACTION_NONE -1
+#define GAME_ACTION_ROTATE_LEFT 0
+#define GAME_ACTION_FORWARD 1
+#define GAME_ACTION_ROTATE_RIGHT 2
+#define GAME_ACTION_SENSE 3
+
+//How a game stands after a step
+#define GAME_OUTCOME_RUNNING 0
+#define GAME_OUTCOME_WIN 1
+#define GAME_OUTCOME_LOSS 2
+#define GAME_OUTCOME_STOPPED 3
+
+//Everything a game of random mode needs, so it can be stepped, paused, and continued at any time
+typedef struct
+{
+  //LRRH's location, her viewing direction, and the value of the tile she is standing on
+  int nLRRHXLocation;
+  int nLRRHYLocation;
+  char cLRRHViewDirection;
+  char cPreviousWalkedTileValue;
+
+  //Items of LRRH, and whether or not the wolf took her bread on the tile she is standing on
+  int nHasFlower;
+  int nHasBread;
+  int nVisitedWoodsman;
+  int nWasBreadTaken;
+
+  int nNumOfSenses;
+  int nNumOfRotations;
+  int nNumOfMovements;
+  int nNumOfTurns;
+
+  //The action of the last step, and the tile it sensed or moved onto
+  int nLastAction;
+  char cLastTile;
+
+  //GAME_OUTCOME value of the game, and why it was stopped if it was (GAME_STOP value)
+  int nOutcome;
+  int nStopReason;
+
+  //The game's own copy of the playing grid
+  char * pPlayGrid;
+  int nGridSize;
+
+  //Whether or not the game can still end from each state (position, direction and items)
+  unsigned char * pCanEndStates;
+
+  //Number of turns the game can take before it is stopped (0 for no limit)
+  int nTurnLimit;
+
+  RandomGenerator Generator;
+
+} RandomGame;
+
+char    convertDirectionToLRRHSymbol    (char cDirection);
+void    initRandomGame                  (RandomGame * pGame,
+                                        char * pPlayGrid,
+                                        int nGridSize,
+                                        int nStartXLocation,
+                                        int nStartYLocation,
+                                        char cStartDirection,
+                                        RandomGenerator * pRandomGenerator,
+                                        int nTurnLimit);
+void    clearRandomGame                 (RandomGame * pGame);
+void    checkRandomGameStop             (RandomGame * pGame);
+int     chooseRandomAction              (RandomGenerator * pGenerator);
+int     stepRandomGame                  (RandomGame * pGame);
+int     advanceRandomGame               (RandomGame * pGame,
+                                        int nNumOfSteps);
@@ -4,7 +4,7 @@
 * Description:
 * 	LRRHFunctions.c: This file contains the behavior that LRRH has for sensing, rotation, movement, and intelligence
 *
-* Last Modified: 06/02/2022
+* Last Modified: 19/10/2026
 * Acknowledgements: 
 *       Pointers and 2D arrays - https://overiq.com/c-programming-101/pointers-and-2-d-arrays/
 *       getchar() function - https://stackoverflow.com/questions/18801483/press-any-key-to-continue-function-in-c/18801616
@@ -13,9 +13,13 @@
 *       Breadth First Search Algorithm on a grid - https://www.youtube.com/watch?v=KiCBXu4P-2Y
 *       A* Pathfinding algorithm - https://www.youtube.com/watch?v=-L-WgKMFuhE
 *       <limits.h> library - https://www.tutorialspoint.com/c_standard_library/limits_h.htm
+*       Bitboards - https://www.chessprogramming.org/Bitboards
+*       Intel Intrinsics Guide - https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html
 */
 
 #include "QueueSystem.c"
+#include "BitboardSystem.c"
+#include "CostScanSystem.c"
 #include "GUIFunctions.c"
 #include "LRRHFunctions_prototype.h"
 
@@ -35,6 +39,45 @@
 #define WOODSMAN_TILE_VALUE 3
 #define FLOWER_TILE_VALUE 2
 
+#define NUM_OF_DIRECTIONS 4
+
+//The flower field, the woodsman's house, and the bakery
+#define NUM_OF_OBJECTIVES 3
+//LRRH's location, every flower field and bakery, the woodsman's house, and granny's house
+#define MAX_OBJECTIVE_STOPS (2 + NUM_OF_OBJECTIVES * JUMBO_MODE_MAX_ELEMENTS)
+
+//How LRRH picks the next tile to explore
+#define FRONTIER_MODE_NEAREST 0
+#define FRONTIER_MODE_INFORMATION_GAIN 1
+#define FRONTIER_MODE_PATH_DISTANCE 2
+#define FRONTIER_MODE_ROLLOUT 3
+
+//When LRRH senses the tiles around her while walking a path
+#define SENSING_MODE_EVERY_STEP 0
+#define SENSING_MODE_DEFERRED 1
+
+//Number of tiles LRRH is willing to walk for each unexplored tile she can sense at the end
+#define FRONTIER_GAIN_WEIGHT 2
+
+//Highest number each action of random mode can be picked with, out of a random number from 0 to RANDOM_ACTION_MAX_NUMBER
+#define RANDOM_ACTION_MAX_NUMBER 100
+#define RANDOM_ROTATE_LEFT_MAX_NUMBER 8
+#define RANDOM_FORWARD_MAX_NUMBER 61
+#define RANDOM_ROTATE_RIGHT_MAX_NUMBER 67
+
+//Number of turns random mode can take before LRRH gives up (0 for no limit)
+#define RANDOM_DEFAULT_TURN_LIMIT 10000
+
+//Why a game was stopped before reaching any of its endings
+#define GAME_STOP_NONE 0
+#define GAME_STOP_TURN_LIMIT 1
+#define GAME_STOP_NO_ENDING 2
+#define GAME_STOP_NO_PROGRESS 3
+
+//Number of times in a row (for each tile of the playing grid) the game loop of smart mode can go around without LRRH
+//sensing a new tile, walking on a new tile, or changing her items before the game is stopped
+#define SMART_IDLE_ITERATIONS_PER_TILE 4
+
 /* This function converts the current direction of LRRH into its X value  (1 if right, -1 if left, 0 if none)
         @param   (char)  cCurrentDirection is the current tile in front of LRRH
         
@@ -129,8 +172,57 @@ directionVectorToSymbol (int xMovement, int yMovement)
 
 }
 
+
+/* This gives the index associated with the direction, counting clockwise starting from the north
+        @param   (char)  cDirection is the associated symbol with the direction
+
+        North gives 0
+        East gives 1
+        South gives 2
+        West gives 3
+        
+        @return  (int) The index of the direction
+*/
+int 
+convertDirectionSymbolToIndex (char cDirection)
+{
+	switch (cDirection){
+	case DIRECTION_EAST:
+		return 1;
+	case DIRECTION_SOUTH:
+		return 2;
+	case DIRECTION_WEST:
+		return 3;
+	default:
+		return 0;
+	}
+}
+
+/* This gives the direction associated with the index, counting clockwise starting from the north
+        @param   (int)  nIndex is the index of the direction (0 to 3)
+        
+        @return  (char) The symbol of the direction
+*/
+char 
+convertIndexToDirectionSymbol (int nIndex)
+{
+	switch (nIndex){
+	case 1:
+		return DIRECTION_EAST;
+	case 2:
+		return DIRECTION_SOUTH;
+	case 3:
+		return DIRECTION_WEST;
+	default:
+		return DIRECTION_NORTH;
+	}
+}
+
 /* This computes the distance between the woodsman and grandmother's house
 
+        @param   (int)  nWoodsmanXCoord is the X location of the woodsman's house (Where LRRH is standing)
+        @param   (int)  nWoodsmanYCoord is the Y location of the woodsman's house (Where LRRH is standing)
+
         @param   (char *)  pPlayGrid is the pointer to carrPlayGrid 
 
         @param   (int)  nGridSize is the grid size of the play grid
@@ -138,26 +230,23 @@ directionVectorToSymbol (int xMovement, int yMovement)
         @return  (int) The distance between the woodsman and grandmother's house
 */
 int 
-computeWoodsmanDistance (char * pPlayGrid, int nGridSize)
+computeWoodsmanDistance (int nWoodsmanXCoord, int nWoodsmanYCoord, char * pPlayGrid, int nGridSize)
 {
-        //Woodsman and Granny Coordinates
-	int nWoodsmanXCoord, nWoodsmanYCoord;
-	int nGrannyXCoord, nGrannyYCoord;
+        //Granny Coordinates
+	int nGrannyXCoord = nWoodsmanXCoord;
+        int nGrannyYCoord = nWoodsmanYCoord;
 	
-        //Get the location of the granny and the woodsman from the play grid
+        //Get the location of the granny from the play grid
         //Do not use the sensed tiles array, since LRRH might meet the woodsman first before granny
+        //The woodsman's house is not searched for, as LRRH is standing on top of it and covers it in the play grid
 
         int i, j;
-	//Loop through the sensed tiles array
+	//Loop through the play grid
 	for (i = 0; i < nGridSize; i++)
         {
 		for (j = 0; j < nGridSize; j++)
                 {		
-			if ( *(pPlayGrid + i * nGridSize + j) == WOLF_TILE)
-                        {
-                                nWoodsmanXCoord = i;
-                                nWoodsmanYCoord = j;
-                        } else if ( *(pPlayGrid + i * nGridSize + j) == GRANDMA_TILE)
+			if ( *(pPlayGrid + i * nGridSize + j) == GRANDMA_TILE)
                         {
                                 nGrannyXCoord = i;
                                 nGrannyYCoord = j;
@@ -321,6 +410,35 @@ smartRotateLRRH (int * pNumOfSenses,
 }
 
 
+/* This function counts the number of rotations smartRotateLRRH will do to face a new direction.
+   LRRH only rotates left if a single left rotation faces the new direction, else she keeps rotating right.
+        @param   (char)  cCurrentDirection is LRRH's current viewing direction
+        @param   (char)  cNewDirection is the target direction that LRRH is aiming for
+        
+        @return  (int) the number of rotations (0 to 3)
+*/
+int 
+countLRRHRotations (char cCurrentDirection, char cNewDirection)
+{
+        int nNumOfRotations = 0;
+
+	//Simulate a left rotation, the same way smartRotateLRRH does
+	char cTestLeftRotation = simulateLeftLRRHRotation (cCurrentDirection);
+
+	while (cCurrentDirection != cNewDirection)
+	{
+		if (cTestLeftRotation == cNewDirection)
+                        cCurrentDirection = simulateLeftLRRHRotation (cCurrentDirection);
+                else
+                        cCurrentDirection = simulateRightLRRHRotation (cCurrentDirection);
+
+                nNumOfRotations++;
+	}
+
+        return nNumOfRotations;
+}
+
+
 /* This function rotates the viewing direction of LRRH to the right
         @param   (int *)  pNumOfMovements is the pointer to nNumOfMovements
         @param   (char *)  cCurrentDirection is the current viewing direction of LRRH
@@ -488,174 +606,165 @@ senseLRRH (int * pNumOfSenses,
 }
 
 /* This function allows LRRH to sense the four adjacent tiles (UP, DOWN, LEFT, RIGHT) around her and determine whether or not
-   She can explore those tiles later on.
-        @param   (int *)  pLRRHXLocation is the pointer to nLRRHXLocation (LRRH's X Location)
-        @param   (int *)  pLRRHYLocation is the pointer to nLRRHYLocation (LRRH's Y Location)
-
-        @param   (int *)  pWolfXCoord is the pointer to nWolfXCoord (Wolf's X Location)
-        @param   (int *)  pWolfYCoord is the pointer to nWolfYCoord (Wolf's Y Location)
+   She can explore those tiles later on. Tiles that are already known are skipped, and the rest are sensed in the order
+   that needs the least rotations.
 
-        @param   (int *)  pSensedTiles is the pointer to the narrSensedTiles Array 
-                (Contains information on which tiles LRRH has already sensed)
+   In deferred sensing mode, while LRRH is in the middle of a path, only the tiles she faces anyway while turning to her
+   next movement are sensed, along with the tiles that could be granny's house. The rest are left for later, and her
+   current location is queued again so that she can come back to sense them if they are worth it.
+        @param   (GameState *)  pGame is the pointer to Game (LRRH, her items, what she knows, and her queues)
+        @param   (char)  cNextMoveDirection is the direction of LRRH's next movement (EMPTY_TILE if it is not known yet)
 
-        @param   (char *)  pLRRHViewDirection is the pointer to cLRRHviewDirection (LRRH's viewing direction)
+        @return  (void) no return value
+*/
+void 
+senseAndQueueLRRHAdjacentTiles (GameState * pGame,
+                        char cNextMoveDirection)
+{
+	
+        //Sense the tiles in each direction around LRRH
+	char carrDirectionSymbols[NUM_OF_DIRECTIONS] = {DIRECTION_NORTH, DIRECTION_EAST, DIRECTION_WEST, DIRECTION_SOUTH};
+	char carrSenseOrder[NUM_OF_DIRECTIONS];
+	int nNumOfSenseDirections = 0;
+	int nNumOfDeferredDirections = 0;
+	int i;
 
-        @param   (int)  nGridSize is the size of the playing grid
+        //Only defer senses in the middle of a path, where the next movement is already known
+        int nCanDefer = (pGame->nSensingMode == SENSING_MODE_DEFERRED && cNextMoveDirection != EMPTY_TILE);
 
-        @param   (int *)  pNumOfSenses is the pointer to nNumOfSenses (Keeps track of LRRH's sense count)
-        @param   (int *)  pNumOfRotations is the pointer to nNumOfRotations (Keeps track of LRRH's rotation count)
-        @param   (int *)  pNumOfMovements is the pointer to nNumOfMovements (Keeps track of LRRH's movement count)
-        @param   (int *)  pNumOfTurns is the pointer to nNumOfTurns (Keeps track of LRRH's turn count)
+        //The number of rotations LRRH needs to face her next movement
+        int nTurnRotations = 0;
 
-        @param   (int *)  pIsGrannyApproachable is the pointer to nIsGrannyApproachable 
-                (Tells whether or not LRRH has all objectives already complete to go to granny's house)
-                
-        @param   (int *)  pHasBread is the pointer to nHasBread 
-                (Tells whether or not LRRH already has went to a bakery and the bread has not been eaten yet)
+        if (nCanDefer)
+                nTurnRotations = countLRRHRotations (pGame->cLRRHViewDirection, cNextMoveDirection);
 
-        @param   (int *)  pHasSensedBread is the pointer to nHasSensedBread 
-                (Tells whether or not LRRH has already spotted a bakery)
-        @param   (int *)  pHasSensedFlower is the pointer to nHasSensedFlower 
-                (Tells whether or not LRRH has already spotted a flower field)
-        @param   (int *)  pHasSensedWoodsman is the pointer to nHasSensedWoodsman 
-                (Tells whether or not LRRH has already spotted the woodsman's house)
-        @param   (int *)  pHasSensedGrandma is the pointer to nHasSensedGrandma 
-                (Tells whether or not LRRH has already spotted granny's house)
+        //Only the adjacent tiles which are not yet sensed need LRRH to rotate to them
+	for (i = 0; i < NUM_OF_DIRECTIONS; i++)
+        {
+		int nXSense = pGame->nLRRHXLocation + convertDirectionSymbolToXMovement (carrDirectionSymbols[i]);
+		int nYSense = pGame->nLRRHYLocation + convertDirectionSymbolToYMovement (carrDirectionSymbols[i]);
+
+		if (isLocationValid (nXSense, nYSense, pGame->nGridSize - 1)){
+                        int nSensedValue = *(pGame->pSensedTiles + nXSense * pGame->nGridSize + nYSense);
+
+			if (nSensedValue == UNEXPLORED_TILE_VALUE){
+
+                                /*A tile is free to sense if LRRH faces it on the way to her next movement.
+                                  A tile on the granny ring could change where LRRH goes, so it is never deferred.*/
+                                int nIsFreeToSense = !nCanDefer || 
+                                                        countLRRHRotations (pGame->cLRRHViewDirection, carrDirectionSymbols[i]) + 
+                                                        countLRRHRotations (carrDirectionSymbols[i], cNextMoveDirection) == nTurnRotations;
+                                int nCouldBeGranny = getBitboardTile (&pGame->pKnowledge->GrannyRingPlane, nXSense, nYSense) &&
+                                                        countBitboardTiles (&pGame->pKnowledge->GrandmaPlane) == 0;
+
+                                if (!nIsFreeToSense && !nCouldBeGranny){
+                                        nNumOfDeferredDirections++;
+                                } else {
+				        carrSenseOrder[nNumOfSenseDirections] = carrDirectionSymbols[i];
+				        nNumOfSenseDirections++;
+                                }
+			}
+		}
+	}
 
-        @param   (Queue *)  pXGridQueue is the pointer to XGridQueue
-                (The queue which stores the X coordinates of the locations to explore later on)
-        @param   (Queue *)  pYGridQueue is the pointer to YGridQueue 
-                (The queue which stores the Y coordinates of the locations to explore later on)
+        //Queue LRRH's location again so that the deferred tiles can be sensed later on
+        if (nNumOfDeferredDirections > 0){
+                enqueue (&pGame->XGridQueue, pGame->nLRRHXLocation);
+                enqueue (&pGame->YGridQueue, pGame->nLRRHYLocation);
+        }
 
-        @param   (int)  nStepByStepMode tells whether or not to wait for user input until the next turn
-        @param   (int)  nHasSounds tells whether or not the application should play sound for each turn
+        //Sense the tiles in the order that needs the least rotations
+        scheduleLRRHSenses (pGame->cLRRHViewDirection, cNextMoveDirection, carrSenseOrder, nNumOfSenseDirections);
+	
+	for (i = 0; i < nNumOfSenseDirections; i++){
+		senseAndQueueLRRHForwardTile (pGame, carrSenseOrder[i]);
+	}
+}
 
+/* This function sorts the directions LRRH has to sense into the order that needs the least rotations.
+   Every order is tried (at most 24 orders for 4 directions), starting from the direction LRRH is currently facing.
+   If LRRH already knows the direction of her next movement, the rotations to face it after sensing are counted as well.
+   If multiple orders need the same number of rotations, the first one tried is kept.
+        @param   (char)  cLRRHViewDirection is LRRH's current viewing direction
+        @param   (char)  cNextMoveDirection is the direction of LRRH's next movement (EMPTY_TILE if it is not known yet)
+        @param   (char *)  pSenseDirections is the pointer to the directions to sense, sorted by this function
+        @param   (int)  nNumOfSenseDirections is the number of directions to sense
+        
         @return  (void) no return value
 */
 void 
-senseAndQueueLRRHAdjacentTiles (int * pLRRHXLocation, 
-                        int * pLRRHYLocation,
-                        int * pWolfXCoord, 
-                        int * pWolfYCoord,
-                        int * pSensedTiles, 
-                        char * pPlayGrid, 
-                        char * pLRRHViewDirection, 
-                        int nGridSize,
-                        int * pNumOfSenses, 
-                        int * pNumOfRotations, 
-                        int * pNumOfMovements, 
-                        int * pNumOfTurns,
-                        int * pIsGrannyApproachable, 
-                        int * pHasBread, 
-                        int * pHasSensedBread, 
-                        int * pHasSensedFlower, 
-                        int * pHasSensedWoodsman, 
-                        int * pHasSensedGrandma,
-                        Queue * pXGridQueue, 
-                        Queue * pYGridQueue, 
-                        int nStepByStepMode, 
-                        int nHasSounds)
+scheduleLRRHSenses (char cLRRHViewDirection, 
+                        char cNextMoveDirection, 
+                        char * pSenseDirections, 
+                        int nNumOfSenseDirections)
 {
-	
-        //Sense the tiles in each direction around LRRH
-	char carrDirectionSymbols[4] = {DIRECTION_NORTH, DIRECTION_EAST, DIRECTION_WEST, DIRECTION_SOUTH};
-	int i;
-	
-	for (i = 0; i < 4; i++){
-		senseAndQueueLRRHForwardTile (pLRRHXLocation, 
-                                                pLRRHYLocation,
-                                                pWolfXCoord, 
-                                                pWolfYCoord, 
-                                                pSensedTiles,
-                                                pPlayGrid, 
-                                                pLRRHViewDirection, 
-                                                nGridSize,
-                                                pNumOfSenses, 
-                                                pNumOfRotations, 
-                                                pNumOfMovements, 
-                                                pNumOfTurns,
-                                                pIsGrannyApproachable, 
-                                                pHasBread, 
-                                                pHasSensedBread, 
-                                                pHasSensedFlower, 
-                                                pHasSensedWoodsman, 
-                                                pHasSensedGrandma,
-                                                pXGridQueue, 
-                                                pYGridQueue, 
-                                                nStepByStepMode, 
-                                                nHasSounds, 
-                                                carrDirectionSymbols[i]);
-	}
-}
+        char carrBestOrder[NUM_OF_DIRECTIONS];
+        int narrOrderIndexes[NUM_OF_DIRECTIONS];
+        int nLowestRotations = INT_MAX;
+        int nNumOfOrders = 1;
+        int i, j, nOrder;
 
-/* This function allows LRRH to sense the tile in front of her and determine whether or not
-   She can explore those tiles later on.
-        @param   (int *)  pLRRHXLocation is the pointer to nLRRHXLocation (LRRH's X Location)
-        @param   (int *)  pLRRHYLocation is the pointer to nLRRHYLocation (LRRH's Y Location)
+        //There are nNumOfSenseDirections to the power of nNumOfSenseDirections ways to pick the indexes
+        for (i = 0; i < nNumOfSenseDirections; i++)
+                nNumOfOrders *= nNumOfSenseDirections;
 
-        @param   (int *)  pWolfXCoord is the pointer to nWolfXCoord (Wolf's X Location)
-        @param   (int *)  pWolfYCoord is the pointer to nWolfYCoord (Wolf's Y Location)
+        for (nOrder = 0; nOrder < nNumOfOrders; nOrder++)
+        {
+                //Split the order number into one index for each sense, like the digits of a number
+                int nRemainingOrder = nOrder;
+                int nIsValidOrder = 1;
 
-        @param   (int *)  pSensedTiles is the pointer to the narrSensedTiles Array 
-                (Contains information on which tiles LRRH has already sensed)
+                for (i = nNumOfSenseDirections - 1; i >= 0; i--)
+                {
+                        narrOrderIndexes[i] = nRemainingOrder % nNumOfSenseDirections;
+                        nRemainingOrder /= nNumOfSenseDirections;
 
-        @param   (char *)  pLRRHViewDirection is the pointer to cLRRHviewDirection (LRRH's viewing direction)
+                        //Each direction should only be sensed once
+                        for (j = i + 1; j < nNumOfSenseDirections; j++)
+                        {
+                                if (narrOrderIndexes[i] == narrOrderIndexes[j])
+                                        nIsValidOrder = 0;
+                        }
+                }
 
-        @param   (int)  nGridSize is the size of the playing grid
+                if (!nIsValidOrder)
+                        continue;
 
-        @param   (int *)  pNumOfSenses is the pointer to nNumOfSenses (Keeps track of LRRH's sense count)
-        @param   (int *)  pNumOfRotations is the pointer to nNumOfRotations (Keeps track of LRRH's rotation count)
-        @param   (int *)  pNumOfMovements is the pointer to nNumOfMovements (Keeps track of LRRH's movement count)
-        @param   (int *)  pNumOfTurns is the pointer to nNumOfTurns (Keeps track of LRRH's turn count)
+                //Count the rotations of sensing each direction in this order
+                char cCurrentDirection = cLRRHViewDirection;
+                int nNumOfRotations = 0;
 
-        @param   (int *)  pIsGrannyApproachable is the pointer to nIsGrannyApproachable 
-                (Tells whether or not LRRH has all objectives already complete to go to granny's house)
+                for (i = 0; i < nNumOfSenseDirections; i++)
+                {
+                        nNumOfRotations += countLRRHRotations (cCurrentDirection, pSenseDirections[narrOrderIndexes[i]]);
+                        cCurrentDirection = pSenseDirections[narrOrderIndexes[i]];
+                }
 
-        @param   (int *)  pHasBread is the pointer to nHasBread 
-                (Tells whether or not LRRH already has went to a bakery and the bread has not been eaten yet)
+                //End the senses facing the next movement if it is already known
+                if (cNextMoveDirection != EMPTY_TILE)
+                        nNumOfRotations += countLRRHRotations (cCurrentDirection, cNextMoveDirection);
 
-        @param   (int *)  pHasSensedBread is the pointer to nHasSensedBread 
-                (Tells whether or not LRRH has already spotted a bakery)
-        @param   (int *)  pHasSensedFlower is the pointer to nHasSensedFlower 
-                (Tells whether or not LRRH has already spotted a flower field)
-        @param   (int *)  pHasSensedWoodsman is the pointer to nHasSensedWoodsman 
-                (Tells whether or not LRRH has already spotted the woodsman's house)
-        @param   (int *)  pHasSensedGrandma is the pointer to nHasSensedGrandma 
-                (Tells whether or not LRRH has already spotted granny's house)
+                if (nNumOfRotations < nLowestRotations){
+                        nLowestRotations = nNumOfRotations;
 
-        @param   (Queue *)  pXGridQueue is the pointer to XGridQueue
-                (The queue which stores the X coordinates of the locations to explore later on)
-        @param   (Queue *)  pYGridQueue is the pointer to YGridQueue 
-                (The queue which stores the Y coordinates of the locations to explore later on)
+                        for (i = 0; i < nNumOfSenseDirections; i++)
+                                carrBestOrder[i] = pSenseDirections[narrOrderIndexes[i]];
+                }
+        }
 
-        @param   (int)  nStepByStepMode tells whether or not to wait for user input until the next turn
-        @param   (int)  nHasSounds tells whether or not the application should play sound for each turn 
+        for (i = 0; i < nNumOfSenseDirections; i++)
+                pSenseDirections[i] = carrBestOrder[i];
+}
+
+/* This function allows LRRH to sense the tile in front of her and determine whether or not
+   She can explore those tiles later on.
+        @param   (GameState *)  pGame is the pointer to Game (LRRH, her items, what she knows, and her queues)
+        @param   (char)  cDirectionSymbol is the direction of the tile to sense
 
         @return  (void) no return value
 */
 void 
-senseAndQueueLRRHForwardTile (int * pLRRHXLocation, 
-                        int * pLRRHYLocation,
-                        int * pWolfXCoord, 
-                        int * pWolfYCoord,
-                        int * pSensedTiles, 
-                        char * pPlayGrid, 
-                        char * pLRRHViewDirection, 
-                        int nGridSize,
-                        int * pNumOfSenses, 
-                        int * pNumOfRotations, 
-                        int * pNumOfMovements, 
-                        int * pNumOfTurns,
-                        int * pIsGrannyApproachable, 
-                        int * pHasBread, 
-                        int * pHasSensedBread, 
-                        int * pHasSensedFlower, 
-                        int * pHasSensedWoodsman, 
-                        int * pHasSensedGrandma,
-                        Queue * pXGridQueue, 
-                        Queue * pYGridQueue, 
-                        int nStepByStepMode, 
-                        int nHasSounds, 
+senseAndQueueLRRHForwardTile (GameState * pGame,
                         char cDirectionSymbol)
 {
 	//Sense what is currently in front of LRRH
@@ -663,43 +772,43 @@ senseAndQueueLRRHForwardTile (int * pLRRHXLocation,
 	int nYSense = convertDirectionSymbolToYMovement (cDirectionSymbol);
 	
         //Check first whether or not the sense location is valid (does not go over / under the grid size)
-	if (isLocationValid (*pLRRHXLocation + nXSense, *pLRRHYLocation + nYSense, nGridSize - 1)){
+	if (isLocationValid (pGame->nLRRHXLocation + nXSense, pGame->nLRRHYLocation + nYSense, pGame->nGridSize - 1)){
 		
                 //If so, get the pointer of the tile to sense
-		int * pTileToSense =  (pSensedTiles +  (*pLRRHXLocation + nXSense) * nGridSize +  (*pLRRHYLocation + nYSense));
+		int * pTileToSense =  (pGame->pSensedTiles +  (pGame->nLRRHXLocation + nXSense) * pGame->nGridSize +  (pGame->nLRRHYLocation + nYSense));
 		
-                //Then, check whether or not the adjacent tile LRRH is currently facing was not yet sensed OR
-                //If the tile has already been sensed, check if it was the wolf's tile.
-                if (*pTileToSense == UNEXPLORED_TILE_VALUE || (*pTileToSense == -WOLF_TILE_VALUE) || (*pTileToSense == WOLF_TILE_VALUE)){
+                /*Then, check whether or not the adjacent tile LRRH is currently facing was not yet sensed.
+                  The wolf never moves, so once sensed, whether or not his tile can be walked on is updated 
+                  whenever LRRH gets or loses her bread instead of sensing it again.*/
+                if (*pTileToSense == UNEXPLORED_TILE_VALUE){
 
                         //If yes, rotate LRRH to face that tile first.
-			smartRotateLRRH (pNumOfSenses, 
-                                        pNumOfRotations, 
-                                        pNumOfMovements, 
-                                        pNumOfTurns,
-                                        pLRRHViewDirection, 
+			smartRotateLRRH (&pGame->nNumOfSenses, 
+                                        &pGame->nNumOfRotations, 
+                                        &pGame->nNumOfMovements, 
+                                        &pGame->nNumOfTurns,
+                                        &pGame->cLRRHViewDirection, 
                                         cDirectionSymbol,
-                                        (pPlayGrid +  (*pLRRHXLocation) * nGridSize +  (*pLRRHYLocation)), 
-                                        pPlayGrid,
-                                        nGridSize,
-                                        nStepByStepMode, 
-                                        nHasSounds);
+                                        (pGame->pPlayGrid + pGame->nLRRHXLocation * pGame->nGridSize + pGame->nLRRHYLocation), 
+                                        pGame->pPlayGrid,
+                                        pGame->nGridSize,
+                                        pGame->nStepByStepMode, 
+                                        pGame->nHasSounds);
 				
 			//Then, Sense what is on that tile.
-			char cLRRHSense = senseLRRH (pNumOfSenses,
-                                                        pLRRHXLocation,
-                                                        pLRRHYLocation, 
-                                                        (pPlayGrid +  (*pLRRHXLocation) * nGridSize +  (*pLRRHYLocation)), 
-                                                        pLRRHViewDirection, 
-                                                        nGridSize);
+			char cLRRHSense = senseLRRH (&pGame->nNumOfSenses,
+                                                        &pGame->nLRRHXLocation,
+                                                        &pGame->nLRRHYLocation, 
+                                                        (pGame->pPlayGrid + pGame->nLRRHXLocation * pGame->nGridSize + pGame->nLRRHYLocation), 
+                                                        &pGame->cLRRHViewDirection, 
+                                                        pGame->nGridSize);
 			
-                        displayPlayGridWithSense (pPlayGrid, 
-                                                        nGridSize, 
-                                                        *pNumOfSenses, 
-                                                        *pNumOfRotations, 
-                                                        *pNumOfMovements, 
+                        displayPlayGridWithSense (pGame->pPlayGrid, 
+                                                        pGame->nGridSize, 
+                                                        pGame->nNumOfSenses, 
+                                                        pGame->nNumOfRotations, 
+                                                        pGame->nNumOfMovements, 
                                                         cLRRHSense);
-                        waitForNextTurn (pNumOfTurns, nStepByStepMode, nHasSounds);
 			/*
 				Assign a positive value if LRRH can walk on the tile and negative if not
 				Flower: FLOWER_TILE_VALUE
@@ -715,100 +824,150 @@ senseAndQueueLRRHForwardTile (int * pLRRHXLocation,
                         /*When spotting a special element, mark that element has sensed and assign its corresponding 
                           Sense value into the narrSensedTiles array. this will allow LRRH to access the array later on,
                           making her to able to remember which tiles has she sensed and where on the gird they are.*/
+                        int nSensedTileValue = *pTileToSense;
+
 			switch (cLRRHSense){
 			case FLOWER_SENSE_TILE:
-				*pHasSensedFlower = 1;
-				*pTileToSense = FLOWER_TILE_VALUE;						
+				pGame->nHasSensedFlower = 1;
+				nSensedTileValue = FLOWER_TILE_VALUE;						
 				break;
 			case WOODSMAN_SENSE_TILE:
-				*pHasSensedWoodsman = 1;
-				*pTileToSense = WOODSMAN_TILE_VALUE;						
+				pGame->nHasSensedWoodsman = 1;
+				nSensedTileValue = WOODSMAN_TILE_VALUE;						
 				break;
 			case BAKERY_SENSE_TILE:
-				*pHasSensedBread = 1;
-				*pTileToSense = BAKERY_TILE_VALUE;						
+				pGame->nHasSensedBread = 1;
+				nSensedTileValue = BAKERY_TILE_VALUE;						
 				break;
 			case GRANDMA_SENSE_TILE:
-				*pHasSensedGrandma = 1;	
+				pGame->nHasSensedGrandma = 1;	
 
                                 /*Make granny's house unapproachable when objectives are not fulfilled yet by using 
                                 a negative value to differentiate walkable and unwalkable tiles. */				
-				if  (*pIsGrannyApproachable == 1) 
-                                        *pTileToSense = GRANDMA_TILE_VALUE;
+				if  (pGame->nIsGrannyApproachable == 1) 
+                                        nSensedTileValue = GRANDMA_TILE_VALUE;
 				else 
-                                        *pTileToSense = -GRANDMA_TILE_VALUE;						
+                                        nSensedTileValue = -GRANDMA_TILE_VALUE;						
 				
                                 break;
 			case WOLF_SENSE_TILE:	
                                 /*Make the wolf unapproachable when LRRH does not have bread by using
                                 a negative value to differentiate walkable and unwalkable tiles. */				
-				if  (*pHasBread == 1) 
-                                        *pTileToSense = WOLF_TILE_VALUE;
+				if  (pGame->nHasBread == 1) 
+                                        nSensedTileValue = WOLF_TILE_VALUE;
 				else 
-                                        *pTileToSense = -WOLF_TILE_VALUE;		
+                                        nSensedTileValue = -WOLF_TILE_VALUE;		
 				
                                 /*LRRH will be avoiding the wolf constantly, so it is better to have  
                                 variables for it's location instead*/
                                 
-                                *pWolfXCoord = *pLRRHXLocation + nXSense;
-				*pWolfYCoord = *pLRRHYLocation + nYSense;		
+                                pGame->nWolfXCoord = pGame->nLRRHXLocation + nXSense;
+				pGame->nWolfYCoord = pGame->nLRRHYLocation + nYSense;		
 				
                                 break;
 			case EMPTY_SENSE_TILE:
-				*pTileToSense = WALKABLE_TILE_VALUE;						
+				nSensedTileValue = WALKABLE_TILE_VALUE;						
 				break;
 			case PIT_SENSE_TILE:
-				*pTileToSense = UNWALKABLE_TILE_VALUE;						
+				nSensedTileValue = UNWALKABLE_TILE_VALUE;						
 				break;
 			}						
 
+                        //Remember the sensed value in both the narrSensedTiles Array and the knowledge bit planes
+                        updateSensedTile (pGame->nLRRHXLocation + nXSense, 
+                                        pGame->nLRRHYLocation + nYSense, 
+                                        nSensedTileValue, 
+                                        pGame->pSensedTiles, 
+                                        pGame->pKnowledge, 
+                                        pGame->nGridSize);
 
 			//If the sensed tile is walkable, queue that tile for viewing later.
 			if (*pTileToSense > UNEXPLORED_TILE_VALUE){
-				enqueue (pXGridQueue, *pLRRHXLocation + nXSense);
-				enqueue (pYGridQueue, *pLRRHYLocation + nYSense);
+				enqueue (&pGame->XGridQueue, pGame->nLRRHXLocation + nXSense);
+				enqueue (&pGame->YGridQueue, pGame->nLRRHYLocation + nYSense);
 			}			
+
+                        //Only wait once the sense is remembered, so a path planned during the pause already knows about it
+                        waitForNextTurn (&pGame->nNumOfTurns, pGame->nStepByStepMode, pGame->nHasSounds);
 		}
 	}
 }
 
 
-/* This function allows LRRH to generate a path towards a destinatioin using the tiles that she has sensed before
+/* This function searches for a path towards a destinatioin using the tiles that LRRH has sensed before, without displaying it.
+   The path takes the least number of turns, counting both the movements and the rotations needed to face each tile.
+
+   If a planning budget is given and the search checks more states than the budget allows, the search stops early.
+   The path then only goes to the checked state closest to the destination, and the search continues from there
+   the next time it is called (with a bigger budget if the destination is the same).
         @param   (int)  nLRRHXLocation is the pointer to nLRRHXLocation (LRRH's X Location)
         @param   (int)  nLRRHYLocation is the pointer to nLRRHYLocation (LRRH's Y Location)
+        @param   (char)  cLRRHViewDirection is LRRH's current viewing direction
 
         @param   (int)  nNewLRRHXLocation is the pointer to nLRRHXLocation (LRRH's X Location)
         @param   (int)  nNewLRRHYLocation is the pointer to nLRRHYLocation (LRRH's Y Location)
 
         @param   (int *)  pSensedTiles is the pointer to the narrSensedTiles Array 
                 (Contains information on which tiles LRRH has already sensed)      
-        @param   (char *)  pPlayGrid is the pointer to carrPlayGrid
-
+        @param   (KnowledgeMap *)  pKnowledge is the pointer to Knowledge
+                (The bit planes that mirror the narrSensedTiles and narrWalkedTiles Arrays)
         @param   (int)  nGridSize is the size of the playing grid
 
         @param   (Queue *)  pActionQueue is the pointer to ActionQueue
                 (The queue which stores the actions LRRH will execute later on)
 
         @param   (int *)  pIsDestinationValid is the pointer to nNumOfSenses (Keeps track of LRRH's sense count)
+
+        @param   (PlanningBudget *)  pBudget is the pointer to Budget 
+                (The number of states the path generation can check in a turn, NULL if there is no limit)
+
+        @param   (char *)  pPathGrid is the pointer to a nGridSize x nGridSize grid that will show the path generation
+        @param   (int *)  pPathEndState is the pointer to the state the path ends at (-1 if there is no path)
         
         @return  (void) no return value
 */
 void 
-generateAStarPath (int nLRRHXLocation, 
+searchAStarPath (int nLRRHXLocation, 
                         int nLRRHYLocation,
+                        char cLRRHViewDirection,
                         int nNewLRRHXLocation, 
                         int nNewLRRHYLocation,
                         int * pSensedTiles, 
-                        char * pPlayGrid,
+                        KnowledgeMap * pKnowledge,
                         int nGridSize, 
                         Queue * pActionQueue, 
-                        int * pIsDestinationValid)
+                        int * pIsDestinationValid,
+                        PlanningBudget * pBudget,
+                        char * pPathGrid,
+                        int * pPathEndState)
 {
         //Clear and reinitialize the action queue again before generating the path to clear it of any previous actions
 	clearQueue (pActionQueue);
 	initQueue (pActionQueue);
+
+        *pPathEndState = -1;
+
+        /*Before doing any A* checks, flood fill the sensed tiles 64 tiles at a time to see if the destination can even be reached.
+          Without this, an unreachable destination makes LRRH check every single sensed tile before giving up.*/
+        if (!isBitboardTileReachable (&pKnowledge->WalkablePlane, 
+                                        nLRRHXLocation, 
+                                        nLRRHYLocation, 
+                                        nNewLRRHXLocation, 
+                                        nNewLRRHYLocation)){
+
+                //Prevent that tile from being reached ever again, and do not generate the path
+                updateSensedTile (nNewLRRHXLocation, 
+                                nNewLRRHYLocation, 
+                                UNWALKABLE_TILE_VALUE, 
+                                pSensedTiles, 
+                                pKnowledge, 
+                                nGridSize);
+
+                *pIsDestinationValid = 0;
+                return;
+        }
 	
-        //Save the coordinates of the wolf IF he happens to be passed by during the path generation
+        //Save the coordinates of the wolf IF he happens to be passed by on the generated path
 	int nWolfXCoord = -1;
 	int nWolfYCoord = -1;
 	int nPathMeetsWolf = 0;
@@ -816,51 +975,50 @@ generateAStarPath (int nLRRHXLocation,
         //For determining whether or not a destination is impossible to go to without passing through the wolf
 	int nShouldGeneratePath = 1;
 
-	//H costs and G costs arrays, used for path generation
-	int narrGCosts[nGridSize][nGridSize];
-	int narrHCosts[nGridSize][nGridSize];
+        /*Every tile is split into 4 states, one for each direction LRRH can be facing while standing on it.
+          The state of a tile facing a direction is found at (X * nGridSize + Y) * NUM_OF_DIRECTIONS + Direction Index*/
+        int nNumOfStates = nGridSize * nGridSize * NUM_OF_DIRECTIONS;
+
+	//H costs and G costs arrays of each state, used for path generation
+	int narrGCosts[nNumOfStates];
+	int narrHCosts[nNumOfStates];
 	
-	//Stores the tiles already viewed by LRRH
-	int narrViewedTiles[nGridSize][nGridSize];
+	//Stores the states already viewed by LRRH
+	int narrViewedStates[nNumOfStates];
 
-        //Stores the path that will be generated by LRRH
-	char carrPathGrid[nGridSize][nGridSize];
-	int i, j;
+        //Stores the direction LRRH was facing on the previous tile before moving into each state
+        char carrPreviousDirections[nNumOfStates];
 
-        /*If the number of checks LRRH does while checking the path goes over the maximum allowed of checks,
-          that means that going to the destination is impossible*/
-	int nMaxAllowedChecks = nGridSize * nGridSize;
+	int i, j;
 
 	for (i = 0; i < nGridSize; i++)
         {
 		for (j = 0; j < nGridSize; j++)
                 {
-			if (* (pSensedTiles + i * nGridSize + j) > 0){
-                                //Initialize the tiles as unexplored
-				narrGCosts[i][j] = UNEXPLORED_TILE_VALUE;
-				narrHCosts[i][j] = UNEXPLORED_TILE_VALUE;
-
-				narrViewedTiles[i][j] = UNEXPLORED_TILE_VALUE;
-                                carrPathGrid[i][j] = SENSED_PATH_TILE;
-			} else {
-                                //Mark with a negative value to prevent using those tiles for path generation
-				narrGCosts[i][j] = -1;
-				narrHCosts[i][j] = -1;
+                        int nState = (i * nGridSize + j) * NUM_OF_DIRECTIONS;
+                        int nDirection;
 
-                                //Subtract the number of max allowed checks, as she cannot check unsensed tiles
-				nMaxAllowedChecks--;
+			for (nDirection = 0; nDirection < NUM_OF_DIRECTIONS; nDirection++)
+                        {
+                                if (* (pSensedTiles + i * nGridSize + j) > 0){
+                                        //Initialize the states as unexplored
+                                        narrGCosts[nState + nDirection] = UNEXPLORED_TILE_VALUE;
+                                        narrHCosts[nState + nDirection] = UNEXPLORED_TILE_VALUE;
+                                        narrViewedStates[nState + nDirection] = UNEXPLORED_TILE_VALUE;
+                                } else {
+                                        //Mark with a negative value to prevent using those states for path generation
+                                        narrGCosts[nState + nDirection] = -1;
+                                        narrHCosts[nState + nDirection] = -1;
+                                        narrViewedStates[nState + nDirection] = UNWALKABLE_TILE_VALUE;
+                                }
+                        }
 
-                                //Make those tiles unwalkable
-                                narrViewedTiles[i][j] = UNWALKABLE_TILE_VALUE;
-                                carrPathGrid[i][j] = UNWALKABLE_PATH_TILE;
-			}
-			
-			
+                        if (* (pSensedTiles + i * nGridSize + j) > 0)
+                                *(pPathGrid + i * nGridSize + j) = SENSED_PATH_TILE;
+                        else
+                                *(pPathGrid + i * nGridSize + j) = UNWALKABLE_PATH_TILE;
 		}
 	}
-	
-        //Prevent backtrack to the starting point by marking it unwalkable
-	narrViewedTiles[nLRRHXLocation][nLRRHYLocation] = UNWALKABLE_TILE_VALUE;
 
 	//A* Path Generation
 
@@ -868,9 +1026,12 @@ generateAStarPath (int nLRRHXLocation,
                 A* Path generation uses costs assigned on each tile. The tile with the lowest cost is determined to be
                 the best step to take next. This continues until the path reaches the destination.
 
+                Moving to a tile is not the only thing that takes a turn, each rotation LRRH does to face the tile also takes one.
+                So instead of only looking at tiles, the path generation looks at states: a tile and the direction LRRH is facing on it.
+
                 Steps of A* path generation:
 
-                1. At the starting point, assign cost values to the adjacent tiles 
+                1. At the starting state, assign cost values to the states of the adjacent tiles 
                         (Standard A* path generation assigns cost values to all 8 surrounding tiles,
                         This algorithm has been modified to only assign values to the 4 cardinal directions,
                         As LRRH can only move in those directions at a time)
@@ -878,48 +1039,109 @@ generateAStarPath (int nLRRHXLocation,
                         (Standard A* path generation also requires the agent to have knowledge of the entire grid.
                         This part is modified, by only using the sensed tiles, or what LRRH only knows.)
                         3 types of cost values will be used:
-                        1. The GCosts - The distance of the adjacent tile to the starting point
+                        1. The GCosts - The number of turns (rotations and movements) to get from the starting point to the state
                         2. The HCosts - The distance of the adjacent tile to the destination
                         3. The FCosts - The sum of the GCosts and the HCosts
-                2. After assigning the cost values, get the tile with the LOWEST FCost, if multiple tiles have
+                2. After assigning the cost values, get the state with the LOWEST FCost, if multiple states have
                    the same LOWEST FCost, get the LOWEST HCosts (closest to destination) from them. This ensures
-                   that LRRH will take the shortest path based on the tiles she has already explored.
-                3. After getting the tile with the LOWEST FCost, repeat steps 1 and 2, only now, use the adjacent tiles
-                   of the tile with the LOWEST FCost.
-                4. Repeat this process until the tile with the LOWEST FCost REACHES THE DESTINATION.
+                   that LRRH will take the path with the least turns based on the tiles she has already explored.
+                3. After getting the state with the LOWEST FCost, repeat steps 1 and 2, only now, use the adjacent tiles
+                   of the state with the LOWEST FCost.
+                4. Repeat this process until the state with the LOWEST FCost REACHES THE DESTINATION.
                 5. Once it has, starting from the destination, retrace the steps taken to generate the path.
                 6. Finally, make the agent perform the steps in reverse.
         */
 
-        //Saves the coordinates of the tile that will be used for generating adjacent FCosts
-        //Start at the starting point
-	int nFCostXCoord = nLRRHXLocation;
-	int nFCostYCoord = nLRRHYLocation;
-	
-        //Will be used for retracing the steps
-	int nPreviousXCoord = 0;
-        int nPreviousYCoord = 0;	
-	
+        //Start at the starting point, facing the direction LRRH is currently facing
+	int nStartState = (nLRRHXLocation * nGridSize + nLRRHYLocation) * NUM_OF_DIRECTIONS + 
+                                convertDirectionSymbolToIndex (cLRRHViewDirection);
         
-	
-        //Used to check if a destination can be reached by LRRH
-	int nNumOfChecks = 0;
+        narrGCosts[nStartState] = 0;
+        narrHCosts[nStartState] = getDistance (nLRRHXLocation, nLRRHYLocation, nNewLRRHXLocation, nNewLRRHYLocation);
+        narrViewedStates[nStartState] = WALKABLE_TILE_VALUE;
+        carrPreviousDirections[nStartState] = EMPTY_TILE;
 
-        //Loop until we have reached the max amount of checks
-	while (nNumOfChecks != nMaxAllowedChecks){
-		
-                //Will be used for getting the tile with the lowest F Cost.
-                //Intialize variables to the highest value for sorting later.
-		int nLowestFCost = INT_MAX;
-		int nLowestHCost = INT_MAX;
+        //Saves the state that reached the destination (-1 if the destination cannot be reached)
+        int nDestinationState = -1;
+
+        //The number of states that can still be checked before the search stops early (-1 if there is no limit)
+        int nExpansionsLeft = -1;
+
+        //The checked state closest to the destination, used as the end of the path if the search stops early
+        int nPartialState = -1;
+        int nIsPathPartial = 0;
+
+        if (pBudget != NULL && pBudget->nExpansionBudget > 0){
+
+                //A new destination starts with the normal budget again
+                if (pBudget->nDestinationXCoord != nNewLRRHXLocation || pBudget->nDestinationYCoord != nNewLRRHYLocation){
+                        pBudget->nCurrentBudget = pBudget->nExpansionBudget;
+                        pBudget->nDestinationXCoord = nNewLRRHXLocation;
+                        pBudget->nDestinationYCoord = nNewLRRHYLocation;
+                }
+
+                nExpansionsLeft = pBudget->nCurrentBudget;
+        }
+
+        //Loop until there are no more states left to check
+	while (1){
+
+		//Look through the H and G Costs of every state for the one with the lowest FCost.
+		int nFCostState = findLowestFCostTile (narrGCosts, 
+                                                        narrHCosts, 
+                                                        narrViewedStates, 
+                                                        WALKABLE_TILE_VALUE, 
+                                                        nNumOfStates);
+
+                //If there are no more states that can be viewed, that means that the destination is impossible to reach.
+		if (nFCostState == -1)
+                        break;
+
+		//Once the state with the lowest FCost has been determined, prevent that same state from being viewed again
+		narrViewedStates[nFCostState] = UNWALKABLE_TILE_VALUE;
+
+                //Split the state into its tile and the direction LRRH is facing on it
+                int nFCostXCoord = nFCostState / NUM_OF_DIRECTIONS / nGridSize;
+                int nFCostYCoord = nFCostState / NUM_OF_DIRECTIONS % nGridSize;
+                char cFCostDirection = convertIndexToDirectionSymbol (nFCostState % NUM_OF_DIRECTIONS);
+
+                //Show which direction LRRH would be moving in when she gets to this tile
+                if (nFCostState != nStartState)
+                        *(pPathGrid + nFCostXCoord * nGridSize + nFCostYCoord) = cFCostDirection;
+
+		//Once we have reached the destination, stop the path generation
+		if (nFCostXCoord == nNewLRRHXLocation && nFCostYCoord == nNewLRRHYLocation){
+                        nDestinationState = nFCostState;
+			break;
+		}
+
+                /*Remember the checked state closest to the destination.
+                  LRRH has to leave her tile for the path to be useful, and she should never stop on the wolf.*/
+                if ((nFCostXCoord != nLRRHXLocation || nFCostYCoord != nLRRHYLocation) &&
+                    *(pSensedTiles + nFCostXCoord * nGridSize + nFCostYCoord) != WOLF_TILE_VALUE &&
+                    (nPartialState == -1 || 
+                     narrHCosts[nFCostState] < narrHCosts[nPartialState] ||
+                    (narrHCosts[nFCostState] == narrHCosts[nPartialState] && narrGCosts[nFCostState] < narrGCosts[nPartialState])))
+                        nPartialState = nFCostState;
+
+                //If the budget has run out, stop early and go to the closest state to the destination for now
+                if (nExpansionsLeft != -1){
+                        nExpansionsLeft--;
+
+                        if (nExpansionsLeft <= 0 && nPartialState != -1){
+                                nDestinationState = nPartialState;
+                                nIsPathPartial = 1;
+                                break;
+                        }
+                }
 
                 //Start checking the adjacent tiles.
 		char cCurrentDirection = DIRECTION_SOUTH;
 
-		/*Check each adjacent tile by looking around each direction of the FCost Tile
+		/*Check each adjacent tile by looking around each direction of the FCost State
 		NOTE: LRRH IS NOT YET MOVING AROUND HERE, 
                 SHE IS SIMPLY LOOKING AT TILES SHE HAS ALREADY SENSED TO FIND THE SHORTEST PATH TO HER DESTINATION. */
-		for (i = 0; i < 4; i++)
+		for (i = 0; i < NUM_OF_DIRECTIONS; i++)
                 {							
 			
                         //Get the X and Y components of the direction
@@ -933,146 +1155,133 @@ generateAStarPath (int nLRRHXLocation,
 			//Check if the adjacent tile is not out of bounds
 			if (isLocationValid (nAdjacentTileX, nAdjacentTileY, nGridSize - 1)){				
 				
-				//Calculate the G and H costs of the adjacent tiles around the current tile
-				int nNewGCost = getDistance (nAdjacentTileX, 
-                                                                nAdjacentTileY, 
-                                                                nLRRHXLocation, 
-                                                                nLRRHYLocation);
+                                //After moving into the adjacent tile, LRRH will be facing the direction she moved in
+                                int nAdjacentState = (nAdjacentTileX * nGridSize + nAdjacentTileY) * NUM_OF_DIRECTIONS + 
+                                                        convertDirectionSymbolToIndex (cCurrentDirection);
+
+				//Rotating towards the adjacent tile and moving into it costs 1 turn each
+				int nNewGCost = narrGCosts[nFCostState] + 
+                                                countLRRHRotations (cFCostDirection, cCurrentDirection) + 1;
 				int nNewHCost = getDistance (nAdjacentTileX, 
                                                                 nAdjacentTileY, 
                                                                 nNewLRRHXLocation, 
                                                                 nNewLRRHYLocation);
 				
-				
-                                //Assign the G and H costs to the tile IF it is not already been viewed during path generation
-				if (narrViewedTiles[nAdjacentTileX][nAdjacentTileY] == 
-                                        UNEXPLORED_TILE_VALUE){	
-					narrGCosts[nAdjacentTileX][nAdjacentTileY] = nNewGCost;
-					narrHCosts[nAdjacentTileX][nAdjacentTileY] = nNewHCost;
+                                //Assign the G and H costs to the state IF it has not been viewed yet, or if this way of getting there takes less turns
+				if (narrViewedStates[nAdjacentState] == UNEXPLORED_TILE_VALUE ||
+                                   (narrViewedStates[nAdjacentState] == WALKABLE_TILE_VALUE && 
+                                    nNewGCost < narrGCosts[nAdjacentState])){	
+					narrGCosts[nAdjacentState] = nNewGCost;
+					narrHCosts[nAdjacentState] = nNewHCost;
 					
-					//Store the CurrentDirection in order to determine the path from the starting point
-					carrPathGrid[nAdjacentTileX][nAdjacentTileY] = cCurrentDirection;
+					//Store the direction of the FCost State in order to determine the path from the starting point
+					carrPreviousDirections[nAdjacentState] = cFCostDirection;
 
-                                        //Allow the adjacent tile to be used for the path
-					narrViewedTiles[nAdjacentTileX][nAdjacentTileY] = WALKABLE_TILE_VALUE;
+                                        //Allow the adjacent state to be used for the path
+					narrViewedStates[nAdjacentState] = WALKABLE_TILE_VALUE;
 				}				
 			}
 			
 			//Switch the direction and go to view the next tile
 			cCurrentDirection = simulateRightLRRHRotation (cCurrentDirection);		
 		}
-		
-                //After checking each adjacent tile, save the previous F costs first before calculating the new one
-		nPreviousXCoord = nFCostXCoord;
-		nPreviousYCoord = nFCostYCoord;
-		
-		//Loop through the H and C Costs
-		for (i = 0; i < nGridSize; i++)
-                {
-			for (j = 0; j < nGridSize; j++)
-                        {
-				int nCurrentHCost = narrHCosts[i][j];
-				int nCurrentFCost = narrGCosts[i][j] + nCurrentHCost;
-				
-                                
-				if (nCurrentFCost >= 0 && narrViewedTiles[i][j] == WALKABLE_TILE_VALUE){
-					
-                                        //If the current F Cost is lower than what is assigned in nLowestFCost
-                                        //Update it to be the lower value and save its coordinates.
-
-					if (nCurrentFCost < nLowestFCost){
-						nLowestFCost = nCurrentFCost;
-						nLowestHCost = nCurrentHCost;
-						nFCostXCoord = i;
-						nFCostYCoord = j;						
-					} else if  (nCurrentFCost == nLowestFCost){
-						//If the current FCost is equal to the Lowest FCost, Check their H costs.
-                                                //If the current HCost is lower or equal to the Lowest FCost, 
-                                                //Update the lowest FCost to be the current FCost and save its coordinates.						
-						if (nCurrentHCost <= nLowestHCost){
-							nLowestFCost = nCurrentFCost;
-							nLowestHCost = nCurrentHCost;
-							nFCostXCoord = i;
-							nFCostYCoord = j;			
-						}
-					}
-				}	
-			}
-		}
-		
-		//Once the spot with the lowest FCost has been determined, prevent that same tile from being viewed again
-		narrViewedTiles[nFCostXCoord][nFCostYCoord] = UNWALKABLE_TILE_VALUE;
-		
-
-                //IF the lowest FCost HAPPENS TO BE THE WOLF TILE, Update the wolf coords and remember that the path
-                //Intersects with the wolf.
-		if (* (pSensedTiles + nFCostXCoord * nGridSize + nFCostYCoord) == WOLF_TILE_VALUE){
-			nWolfXCoord = nFCostXCoord;
-			nWolfYCoord = nFCostYCoord;
-			nPathMeetsWolf = 1;
-		}
-
-		/*Once we have reached the destination, use the previous X and Y FCost coords 
-                  to save the direction between the last and second to last tile and break from the loop.
-		  This will be used to generate the path LRRH will take to the destination. */
-		if (nFCostXCoord == nNewLRRHXLocation && nFCostYCoord == nNewLRRHYLocation){
-			carrPathGrid[nFCostXCoord][nFCostYCoord] = directionVectorToSymbol (nFCostXCoord - nPreviousXCoord,
-                                                                                                nFCostYCoord - nPreviousYCoord);
-			break;
-		}
-
-                //Increment the number of check after each check
-		nNumOfChecks++;
 	}
 
-        //If the number of checks is equal to the max allowed of checks, that means that the destination is impossible to reach.
-	if (nNumOfChecks == nMaxAllowedChecks){
+        //If the destination was never reached, that means that the destination is impossible to reach.
+	if (nDestinationState == -1){
 
                 //Prevent that tile from being reached ever again, and do not generate the path
-		* (pSensedTiles + nNewLRRHXLocation * nGridSize + nNewLRRHYLocation) = UNWALKABLE_TILE_VALUE;
+		updateSensedTile (nNewLRRHXLocation, 
+                                nNewLRRHYLocation, 
+                                UNWALKABLE_TILE_VALUE, 
+                                pSensedTiles, 
+                                pKnowledge, 
+                                nGridSize);
 	
 		*pIsDestinationValid = 0;
 		nShouldGeneratePath = 0;
-	} else if (nPathMeetsWolf){
-		//If the path meets the wolf, try to generate a path that does not intersect the wolf.
-		* (pSensedTiles + nWolfXCoord * nGridSize + nWolfYCoord) = -WOLF_TILE_VALUE;
-		
-                generateAStarPath (nLRRHXLocation, 
-                                        nLRRHYLocation, 
-                                        nNewLRRHXLocation, 
-                                        nNewLRRHYLocation, 
-                                        pSensedTiles, 
-                                        pPlayGrid,
-                                        nGridSize, 
-                                        pActionQueue, 
-                                        pIsDestinationValid);
-
-                /*If the destination is valid, that means it is possible to reach it without crossing on the wolf tile.
-                  Do not generate a new path if so. else, that means it is REQUIRED to cross the wolf tile to reach
-                  the destination, so the path with the wolf tile has to be generated.*/
-		if (*pIsDestinationValid == 1)
-                        nShouldGeneratePath = 0;
-                else 
-                        nShouldGeneratePath = 1;
+	} else {
+                //Retrace the path, starting at the destination, and check if it passes by the wolf
+                int nTracingState = nDestinationState;
+
+                while (nTracingState != nStartState)
+                {
+                        int nTracingXLocation = nTracingState / NUM_OF_DIRECTIONS / nGridSize;
+                        int nTracingYLocation = nTracingState / NUM_OF_DIRECTIONS % nGridSize;
+                        char cTracingDirection = convertIndexToDirectionSymbol (nTracingState % NUM_OF_DIRECTIONS);
+
+                        //Show the direction used on the final path
+                        *(pPathGrid + nTracingXLocation * nGridSize + nTracingYLocation) = cTracingDirection;
+
+                        //IF the path HAPPENS TO PASS BY THE WOLF TILE, Update the wolf coords and remember that the path
+                        //Intersects with the wolf.
+                        if (* (pSensedTiles + nTracingXLocation * nGridSize + nTracingYLocation) == WOLF_TILE_VALUE){
+                                nWolfXCoord = nTracingXLocation;
+                                nWolfYCoord = nTracingYLocation;
+                                nPathMeetsWolf = 1;
+                        }
+
+                        //Move the tracing location opposite to the direction used to get into the tile
+                        nTracingXLocation -= convertDirectionSymbolToXMovement (cTracingDirection);
+                        nTracingYLocation -= convertDirectionSymbolToYMovement (cTracingDirection);
+                        
+                        nTracingState = (nTracingXLocation * nGridSize + nTracingYLocation) * NUM_OF_DIRECTIONS + 
+                                                convertDirectionSymbolToIndex (carrPreviousDirections[nTracingState]);
+                }
+
+                if (nPathMeetsWolf){
+                        //If the path meets the wolf, try to generate a path that does not intersect the wolf.
+                        updateSensedTile (nWolfXCoord, nWolfYCoord, -WOLF_TILE_VALUE, pSensedTiles, pKnowledge, nGridSize);
+                        
+                        //The path without the wolf gets its own path grid, so it does not overwrite this one if it fails
+                        char carrWolfFreePathGrid[nGridSize * nGridSize];
+                        int nWolfFreePathEndState;
+
+                        searchAStarPath (nLRRHXLocation, 
+                                                nLRRHYLocation, 
+                                                cLRRHViewDirection,
+                                                nNewLRRHXLocation, 
+                                                nNewLRRHYLocation, 
+                                                pSensedTiles, 
+                                                pKnowledge,
+                                                nGridSize, 
+                                                pActionQueue, 
+                                                pIsDestinationValid,
+                                                pBudget,
+                                                carrWolfFreePathGrid,
+                                                &nWolfFreePathEndState);
+
+                        /*If the destination is valid, that means it is possible to reach it without crossing on the wolf tile.
+                          Do not generate a new path if so. else, that means it is REQUIRED to cross the wolf tile to reach
+                          the destination, so the path with the wolf tile has to be generated.*/
+                        if (*pIsDestinationValid == 1){
+                                memcpy (pPathGrid, carrWolfFreePathGrid, nGridSize * nGridSize);
+                                *pPathEndState = nWolfFreePathEndState;
+                                nShouldGeneratePath = 0;
+                        } else 
+                                nShouldGeneratePath = 1;
+
+                        //The wolf was only blocked for the path generation, LRRH still has her bread so he can be walked on again
+                        updateSensedTile (nWolfXCoord, nWolfYCoord, WOLF_TILE_VALUE, pSensedTiles, pKnowledge, nGridSize);
+                }
 	}
 	
 	if (nShouldGeneratePath){
                 /*After generating the path, start backtracking from the end.
-                  Starting from the end is important as the path may not neccessarily 
-                  be complete if we started at the starting point.
-                  This is because the assigned directions on the path grid may lead to other destinations as well.*/
+                  Starting from the end is important as each state only remembers the state it came from.*/
 
                 //Trace the path, starting at the destination.
-                int nTracingXLocation = nNewLRRHXLocation;
-                int nTracingYLocation = nNewLRRHYLocation;
-
-		//Get the saved direction in the path grid
-		char cCurrentTracingDirection = carrPathGrid[nTracingXLocation][nTracingYLocation];
+                int nTracingState = nDestinationState;
 
 		//Retrace the steps taken
 		//Do this while you are still not in the starting point
-		while (nTracingXLocation != nLRRHXLocation || nTracingYLocation != nLRRHYLocation)
+		while (nTracingState != nStartState)
                 {
+                        int nTracingXLocation = nTracingState / NUM_OF_DIRECTIONS / nGridSize;
+                        int nTracingYLocation = nTracingState / NUM_OF_DIRECTIONS % nGridSize;
+
+                        //LRRH moved into this tile while facing the direction of the state
+                        char cCurrentTracingDirection = convertIndexToDirectionSymbol (nTracingState % NUM_OF_DIRECTIONS);
 			
 			//Store the traced direction into a queue, then move opposite that direction
 			enqueue (pActionQueue,  (int) cCurrentTracingDirection);
@@ -1080,18 +1289,16 @@ generateAStarPath (int nLRRHXLocation,
                         //Get the direction opposite to the saved direction
                         char cOppositeDirection = getOppositeDirection (cCurrentTracingDirection);
 			
-			/*Move the tracing location opposite to the direction in the Path Grid.
-                          This is because the Path Grid saved the directions of the tiles that
+			/*Move the tracing location opposite to the direction of the state.
+                          This is because the states saved the directions of the tiles that
                           started from the starting point towards the destination. However, we
                           are moving the opposite direction.*/
-			int nXDirection = convertDirectionSymbolToXMovement (cOppositeDirection);
-			int nYDirection = convertDirectionSymbolToYMovement (cOppositeDirection);
-			
-			nTracingXLocation += nXDirection;
-			nTracingYLocation += nYDirection;
+			nTracingXLocation += convertDirectionSymbolToXMovement (cOppositeDirection);
+			nTracingYLocation += convertDirectionSymbolToYMovement (cOppositeDirection);
 			
-			//Get the new tracing direction and repeat.
-			cCurrentTracingDirection = carrPathGrid[nTracingXLocation][nTracingYLocation];
+			//Get the previous state and repeat.
+			nTracingState = (nTracingXLocation * nGridSize + nTracingYLocation) * NUM_OF_DIRECTIONS + 
+                                                convertDirectionSymbolToIndex (carrPreviousDirections[nTracingState]);
 		}
 		
                 //Set the destination as valid, as the path has reached the starting point
@@ -1100,30 +1307,32 @@ generateAStarPath (int nLRRHXLocation,
                 //Reverse the order of directions in the action queue, as the generation started from the destination
                 reverseQueue (pActionQueue);
 
-                //Display the play grid and Path generation to the user
-                printf ("\n");
-                displayDivider ();
-                printf ("\nStarting A* algorithm\n");
-                printf ("Current Location: %d, %d\n", nLRRHXLocation + 1, nLRRHYLocation + 1);
-                printf ("Destination: %d, %d\n", nNewLRRHXLocation + 1, nNewLRRHYLocation + 1);
-                displayDivider ();
-                printf ("\n");
-                displayPlayAndPathGrid(pPlayGrid, &carrPathGrid[0][0], nGridSize, pActionQueue->pArray, pActionQueue->nCount);
+                //Give the next search toward the same destination a bigger budget, or reset it once the destination is reached
+                if (pBudget != NULL && pBudget->nExpansionBudget > 0){
+                        if (nIsPathPartial && pBudget->nCurrentBudget < nNumOfStates)
+                                pBudget->nCurrentBudget *= 2;
+                        else if (!nIsPathPartial)
+                                pBudget->nCurrentBudget = pBudget->nExpansionBudget;
+                }
+
+                //Remember where the path ends, so it can be displayed later
+                *pPathEndState = nDestinationState;
 	}	
 }
 
-/* This function allows LRRH to search for the closest bakery and generate a path to get to there
+/* This function allows LRRH to generate a path towards a destinatioin using the tiles that she has sensed before,
+   then displays the path generation to the user.
         @param   (int)  nLRRHXLocation is the pointer to nLRRHXLocation (LRRH's X Location)
         @param   (int)  nLRRHYLocation is the pointer to nLRRHYLocation (LRRH's Y Location)
+        @param   (char)  cLRRHViewDirection is LRRH's current viewing direction
 
-        @param   (int *)  nBakeryXCoord is the pointer to nLRRHXLocation (LRRH's X Location)
-        @param   (int *)  nBakeryYCoord is the pointer to nLRRHYLocation (LRRH's Y Location)
-
-        @param   (int *)  pHasSensedBread is the pointer to nHasSensedBread
-                (Tells whether or not LRRH has already spotted a bakery)
+        @param   (int)  nNewLRRHXLocation is the pointer to nLRRHXLocation (LRRH's X Location)
+        @param   (int)  nNewLRRHYLocation is the pointer to nLRRHYLocation (LRRH's Y Location)
 
         @param   (int *)  pSensedTiles is the pointer to the narrSensedTiles Array 
-                (Contains information on which tiles LRRH has already sensed)
+                (Contains information on which tiles LRRH has already sensed)      
+        @param   (KnowledgeMap *)  pKnowledge is the pointer to Knowledge
+                (The bit planes that mirror the narrSensedTiles and narrWalkedTiles Arrays)
         @param   (char *)  pPlayGrid is the pointer to carrPlayGrid
 
         @param   (int)  nGridSize is the size of the playing grid
@@ -1132,20 +1341,146 @@ generateAStarPath (int nLRRHXLocation,
                 (The queue which stores the actions LRRH will execute later on)
 
         @param   (int *)  pIsDestinationValid is the pointer to nNumOfSenses (Keeps track of LRRH's sense count)
+
+        @param   (PlanningBudget *)  pBudget is the pointer to Budget 
+                (The number of states the path generation can check in a turn, NULL if there is no limit)
         
         @return  (void) no return value
 */
 void 
-generatePathToClosestBakery (int nLRRHXLocation, 
-                                int nLRRHYLocation, 
-                                int * nBakeryXCoord, 
-                                int * nBakeryYCoord,
-                                int * pHasSensedBread,
+generateAStarPath (int nLRRHXLocation, 
+                        int nLRRHYLocation,
+                        char cLRRHViewDirection,
+                        int nNewLRRHXLocation, 
+                        int nNewLRRHYLocation,
+                        int * pSensedTiles, 
+                        KnowledgeMap * pKnowledge,
+                        char * pPlayGrid,
+                        int nGridSize, 
+                        Queue * pActionQueue, 
+                        int * pIsDestinationValid,
+                        PlanningBudget * pBudget)
+{
+        //Stores the path that will be generated by LRRH
+	char carrPathGrid[nGridSize][nGridSize];
+        int nPathEndState;
+
+        searchAStarPath (nLRRHXLocation, 
+                                nLRRHYLocation, 
+                                cLRRHViewDirection,
+                                nNewLRRHXLocation, 
+                                nNewLRRHYLocation, 
+                                pSensedTiles, 
+                                pKnowledge,
+                                nGridSize, 
+                                pActionQueue, 
+                                pIsDestinationValid,
+                                pBudget,
+                                &carrPathGrid[0][0],
+                                &nPathEndState);
+
+        if (*pIsDestinationValid)
+                displayAStarPath (nLRRHXLocation, 
+                                        nLRRHYLocation, 
+                                        nNewLRRHXLocation, 
+                                        nNewLRRHYLocation, 
+                                        nPathEndState,
+                                        pPlayGrid, 
+                                        &carrPathGrid[0][0], 
+                                        nGridSize, 
+                                        pActionQueue);
+}
+
+/* This function displays the play grid and the path generation of a path generated by searchAStarPath
+        @param   (int)  nLRRHXLocation is the pointer to nLRRHXLocation (LRRH's X Location)
+        @param   (int)  nLRRHYLocation is the pointer to nLRRHYLocation (LRRH's Y Location)
+
+        @param   (int)  nNewLRRHXLocation is the pointer to nLRRHXLocation (LRRH's X Location)
+        @param   (int)  nNewLRRHYLocation is the pointer to nLRRHYLocation (LRRH's Y Location)
+        @param   (int)  nPathEndState is the state the path ends at
+
+        @param   (char *)  pPlayGrid is the pointer to carrPlayGrid
+        @param   (char *)  pPathGrid is the pointer to the grid showing the path generation
+
+        @param   (int)  nGridSize is the size of the playing grid
+
+        @param   (Queue *)  pActionQueue is the pointer to ActionQueue
+                (The queue which stores the actions LRRH will execute later on)
+        
+        @return  (void) no return value
+*/
+void 
+displayAStarPath (int nLRRHXLocation, 
+                        int nLRRHYLocation,
+                        int nNewLRRHXLocation, 
+                        int nNewLRRHYLocation,
+                        int nPathEndState,
+                        char * pPlayGrid,
+                        char * pPathGrid,
+                        int nGridSize, 
+                        Queue * pActionQueue)
+{
+        int nPathEndXLocation = nPathEndState / NUM_OF_DIRECTIONS / nGridSize;
+        int nPathEndYLocation = nPathEndState / NUM_OF_DIRECTIONS % nGridSize;
+
+        //Display the play grid and Path generation to the user
+        printf ("\n");
+        displayDivider ();
+        printf ("\nStarting A* algorithm\n");
+        printf ("Current Location: %d, %d\n", nLRRHXLocation + 1, nLRRHYLocation + 1);
+        printf ("Destination: %d, %d\n", nNewLRRHXLocation + 1, nNewLRRHYLocation + 1);
+
+        //If the planning budget ran out, the path does not reach the destination yet
+        if (nPathEndXLocation != nNewLRRHXLocation || nPathEndYLocation != nNewLRRHYLocation)
+                printf ("The planning budget ran out, going to %d, %d first\n", nPathEndXLocation + 1, nPathEndYLocation + 1);
+        displayDivider ();
+        printf ("\n");
+        displayPlayAndPathGrid(pPlayGrid, pPathGrid, nGridSize, pActionQueue->pArray, pActionQueue->nCount);
+}
+
+/* This function allows LRRH to search for the closest bakery and generate a path to get to there
+        @param   (int)  nLRRHXLocation is the pointer to nLRRHXLocation (LRRH's X Location)
+        @param   (int)  nLRRHYLocation is the pointer to nLRRHYLocation (LRRH's Y Location)
+        @param   (char)  cLRRHViewDirection is LRRH's current viewing direction
+
+        @param   (int *)  nBakeryXCoord is the pointer to nLRRHXLocation (LRRH's X Location)
+        @param   (int *)  nBakeryYCoord is the pointer to nLRRHYLocation (LRRH's Y Location)
+
+        @param   (int *)  pHasSensedBread is the pointer to nHasSensedBread
+                (Tells whether or not LRRH has already spotted a bakery)
+
+        @param   (int *)  pSensedTiles is the pointer to the narrSensedTiles Array 
+                (Contains information on which tiles LRRH has already sensed)
+        @param   (KnowledgeMap *)  pKnowledge is the pointer to Knowledge
+                (The bit planes that mirror the narrSensedTiles and narrWalkedTiles Arrays)
+        @param   (char *)  pPlayGrid is the pointer to carrPlayGrid
+
+        @param   (int)  nGridSize is the size of the playing grid
+
+        @param   (Queue *)  pActionQueue is the pointer to ActionQueue
+                (The queue which stores the actions LRRH will execute later on)
+
+        @param   (int *)  pIsDestinationValid is the pointer to nNumOfSenses (Keeps track of LRRH's sense count)
+
+        @param   (PlanningBudget *)  pBudget is the pointer to Budget 
+                (The number of states the path generation can check in a turn, NULL if there is no limit)
+        
+        @return  (void) no return value
+*/
+void 
+generatePathToClosestBakery (int nLRRHXLocation, 
+                                int nLRRHYLocation, 
+                                char cLRRHViewDirection,
+                                int * nBakeryXCoord, 
+                                int * nBakeryYCoord,
+                                int * pHasSensedBread,
                                 int * pSensedTiles, 
+                                KnowledgeMap * pKnowledge,
                                 char * pPlayGrid,
                                 int nGridSize, 
                                 Queue * pActionQueue, 
-                                int * pIsDestinationValid)
+                                int * pIsDestinationValid,
+                                PlanningBudget * pBudget)
 {
 	
 	/*There can only be a maximum of 9 bakeries FOR ALL GAME MODES,
@@ -1155,23 +1490,27 @@ generatePathToClosestBakery (int nLRRHXLocation,
 	int narrBakeryXCoords[JUMBO_MODE_MAX_ELEMENTS] = {-1, -1, -1, -1, -1, -1, -1, -1, -1};
 	int narrBakeryYCoords[JUMBO_MODE_MAX_ELEMENTS] = {-1, -1, -1, -1, -1, -1, -1, -1, -1};
 	int nNumOfBakeries = 0;
-	int i, j;
+	int i;
 	
+        //Look for the bakeries in the bakery plane, skipping every row that has no bakery in it
 	for (i = 0; i < nGridSize; i++)
         {
-		for (j = 0; j < nGridSize; j++)
+                unsigned long long ullBakeryRow = pKnowledge->BakeryPlane.ullarrRows[i];
+
+		while (ullBakeryRow)
                 {		
-			//Look for the bakeries in the sensed tiles
-			if (* (pSensedTiles + i * nGridSize + j) == BAKERY_TILE_VALUE){
-				//Calculate the distance between LRRH and this bakery and save its coordinates			
-				narrDistances[nNumOfBakeries] = getDistance (i, j, nLRRHXLocation, nLRRHYLocation);
-				narrBakeryXCoords[nNumOfBakeries] = i;
-				narrBakeryYCoords[nNumOfBakeries] = j;
-				
-                                //Increment the number of bakeries
-				nNumOfBakeries++;
-			}
-				
+                        int j = getLowestBitboardRowBit (ullBakeryRow);
+
+                        //Calculate the distance between LRRH and this bakery and save its coordinates			
+                        narrDistances[nNumOfBakeries] = getDistance (i, j, nLRRHXLocation, nLRRHYLocation);
+                        narrBakeryXCoords[nNumOfBakeries] = i;
+                        narrBakeryYCoords[nNumOfBakeries] = j;
+                        
+                        //Increment the number of bakeries
+                        nNumOfBakeries++;
+
+                        //Clear the bit of the bakery that was just saved
+                        ullBakeryRow &= ullBakeryRow - 1ULL;
 		}
 	}
 	
@@ -1197,13 +1536,16 @@ generatePathToClosestBakery (int nLRRHXLocation,
 	//Proceed to A star while using the closest bakery as the new location.
 	generateAStarPath (nLRRHXLocation, 
                                 nLRRHYLocation, 
+                                cLRRHViewDirection,
                                 *nBakeryXCoord, 
                                 *nBakeryYCoord,
                                 pSensedTiles, 
+                                pKnowledge,
                                 pPlayGrid,
                                 nGridSize, 
                                 pActionQueue, 
-                                pIsDestinationValid);
+                                pIsDestinationValid,
+                                pBudget);
         
         //If the path generation has failed, that means that the closest bakery is unreachable.
         if(*pIsDestinationValid == 0)
@@ -1229,13 +1571,16 @@ generatePathToClosestBakery (int nLRRHXLocation,
                         //Proceed to A star while using the new bakery as the new location.
                         generateAStarPath (nLRRHXLocation, 
                                                 nLRRHYLocation, 
+                                                cLRRHViewDirection,
                                                 *nBakeryXCoord, 
                                                 *nBakeryYCoord,
                                                 pSensedTiles, 
+                                                pKnowledge,
                                                 pPlayGrid,
                                                 nGridSize, 
                                                 pActionQueue, 
-                                                pIsDestinationValid);
+                                                pIsDestinationValid,
+                                                pBudget);
                         
                         
                 }
@@ -1247,556 +1592,1116 @@ generatePathToClosestBakery (int nLRRHXLocation,
         }
 }
 
+/* This function finds the queued tile LRRH can walk to in the least number of moves, and generates the path to get there.
+   A single BFS wave is spread from LRRH over the walkable tiles she has sensed, which gives the walking distance of every tile.
+   Unlike the distance used to sort the queues, this goes around the pits and unwalkable tiles LRRH knows about.
+   The path is then retraced from the chosen tile by always stepping to a tile one move closer to LRRH, so no A* is needed.
 
-/* This function allows LRRH to move to a specific location using a generated path.
-        @param   (int *)  pLRRHXLocation is the pointer to nLRRHXLocation (LRRH's X Location)
-        @param   (int *)  pLRRHYLocation is the pointer to nLRRHYLocation (LRRH's Y Location)
+   Like the A* path generation, the wolf is avoided first. He is only walked on if the dequeued tile cannot be reached
+   without him and no other queued tile can be reached either.
+        @param   (int)  nLRRHXLocation is LRRH's X Location
+        @param   (int)  nLRRHYLocation is LRRH's Y Location
 
-        @param   (int)  nNewLRRHXLocation is the pointer to nLRRHXLocation (LRRH's X Location)
-        @param   (int)  nNewLRRHYLocation is the pointer to nLRRHYLocation (LRRH's Y Location)
+        @param   (int *)  pNewLRRHXLocation is the pointer to the X location of the dequeued tile, replaced by the chosen tile
+        @param   (int *)  pNewLRRHYLocation is the pointer to the Y location of the dequeued tile, replaced by the chosen tile
+        @param   (Queue *)  pXGridQueue is the pointer to XGridQueue
+                (The queue which stores the X coordinates of the locations to explore later on)
+        @param   (Queue *)  pYGridQueue is the pointer to YGridQueue 
+                (The queue which stores the Y coordinates of the locations to explore later on)
+
+        @param   (int *)  pSensedTiles is the pointer to the narrSensedTiles Array 
+                (Contains information on which tiles LRRH has already sensed)
+        @param   (KnowledgeMap *)  pKnowledge is the pointer to Knowledge
+                (The bit planes that mirror the narrSensedTiles and narrWalkedTiles Arrays)
+        @param   (char *)  pPlayGrid is the pointer to carrPlayGrid
 
-        @param   (int *)  pWolfXCoord is the pointer to nWolfXCoord (Wolf's X Location)
-        @param   (int *)  pWolfYCoord is the pointer to nWolfYCoord (Wolf's Y Location)
+        @param   (int)  nGridSize is the size of the playing grid
 
         @param   (Queue *)  pActionQueue is the pointer to ActionQueue
                 (The queue which stores the actions LRRH will execute later on)
 
-        @param   (int *)  pNumOfSenses is the pointer to nNumOfSenses (Keeps track of LRRH's sense count)
-        @param   (int *)  pNumOfRotations is the pointer to nNumOfRotations (Keeps track of LRRH's rotation count)
-        @param   (int *)  pNumOfMovements is the pointer to nNumOfMovements (Keeps track of LRRH's movement count)
-        @param   (int *)  pNumOfTurns is the pointer to nNumOfTurns (Keeps track of LRRH's turn count)
+        @param   (int *)  pIsDestinationValid is the pointer to nIsDestinationValid
+                (Tells whether or not a path to the chosen tile has been generated)
+        
+        @return  (void) no return value
+*/
+void 
+generateBFSPathToClosestTile (int nLRRHXLocation, 
+                                int nLRRHYLocation,
+                                int * pNewLRRHXLocation, 
+                                int * pNewLRRHYLocation,
+                                Queue * pXGridQueue, 
+                                Queue * pYGridQueue,
+                                int * pSensedTiles, 
+                                KnowledgeMap * pKnowledge,
+                                char * pPlayGrid,
+                                int nGridSize, 
+                                Queue * pActionQueue, 
+                                int * pIsDestinationValid)
+{
+        //Clear and reinitialize the action queue again before generating the path to clear it of any previous actions
+	clearQueue (pActionQueue);
+	initQueue (pActionQueue);
 
-        @param   (int)  nGridSize is the size of the playing grid
+        //Walking distance of every tile from LRRH
+        int narrDistances[nGridSize * nGridSize];
 
-        @param   (char *)  pPlayGrid is the pointer to carrPlayGrid
-        @param   (int *)  pWalkedTiles is the pointer to the narrWalkedTiles Array 
-                (Contains information on which tiles LRRH has already walked on)
-        @param   (int *)  pSensedTiles is the pointer to the narrSensedTiles Array 
-                (Contains information on which tiles LRRH has already sensed)
+        //Index of the chosen tile in the queues, -1 if the dequeued tile is chosen
+        int nClosestIndex = -1;
+        int nClosestDistance = -1;
 
-        @param   (int *)  pHasFlower is the pointer to nHasFlower 
-                (Tells whether or not LRRH already has went to a flower field)
-        @param   (int *)  pHasBread is the pointer to nHasBread 
-                (Tells whether or not LRRH already has went to a bakery and the bread has not been eaten yet)
-        @param   (int *)  pVisitedWoodsman is the pointer to nHasBread 
-                (Tells whether or not LRRH already has visited the woodsman's house)
+        Bitboard Walkable;
+        int nCanWalkOnWolf;
+        int i;
 
-        @param   (int *)  pWasBreadTaken is the pointer to nWasBreadTaken 
-                (Tells whether or not LRRH's bread was recently taken by the wolf last turn)
+        //Try without the wolf first, then with the wolf (if he can be given bread) if nothing could be reached
+        for (nCanWalkOnWolf = 0; nCanWalkOnWolf <= 1 && nClosestDistance == -1; nCanWalkOnWolf++)
+        {
+                Walkable = pKnowledge->WalkablePlane;
 
-        @param   (char *)  pLRRHViewDirection is the pointer to cLRRHviewDirection (LRRH's viewing direction)
-        @param   (char *)  pPreviousWalkedTileValue is the pointer to cPreviousWalkedTileValue 
-                (The previous value of the tile LRRH is standing)
+                if (!nCanWalkOnWolf){
+                        for (i = 0; i < nGridSize; i++)
+                        {
+                                Walkable.ullarrRows[i] &= ~pKnowledge->WolfPlane.ullarrRows[i];
+                        }
+                }
 
-        @param   (int)  nStepByStepMode tells whether or not to wait for user input until the next turn
-        @param   (int)  nHasSounds tells whether or not the application should play sound for each turn 
+                computeBitboardDistances (&Walkable, nLRRHXLocation, nLRRHYLocation, narrDistances);
 
-        @return  (void) no return value
-*/
-void 
-moveLRRHToPath (int * pLRRHXLocation, 
-                int * pLRRHYLocation,
-                int nNewLRRHXLocation, 
-                int nNewLRRHYLocation,
-                int * pWolfXCoord, 
-                int * pWolfYCoord,
-                Queue * pActionQueue, 
-                int * pNumOfSenses, 
-                int * pNumOfRotations, 
-                int * pNumOfMovements,
-                int * pNumOfTurns, 
-                int nGridSize, 
-                char * pPlayGrid, 
-                int * pWalkedTiles, 
-                int * pSensedTiles,
-                int * pHasFlower, 
-                int * pHasBread, 
-                int * pVisitedWoodsman, 
-                int * pWasBreadTaken,
-                char * pLRRHViewDirection, 
-                char * pPreviousWalkedTileValue, 
-                int nStepByStepMode, 
-                int nHasSounds)
-{
-	
-	//Check first whether or not LRRH has sensed the wolf
-	int nHasSensedWolf;
+                //Check the dequeued tile first, then the rest of the queue. The first of the closest tiles is chosen.
+                //Only the dequeued tile is worth giving up the bread for
+                int nDistance = narrDistances[*pNewLRRHXLocation * nGridSize + *pNewLRRHYLocation];
 
-	if (*pWolfXCoord == -1 && *pWolfYCoord == -1) 
-                nHasSensedWolf = 0;
-	else 
-                nHasSensedWolf = 1;
-	
-        
-	
-        //Get the current location of LRRH
-	char * pLRRHTile = (pPlayGrid +  (*pLRRHXLocation) * nGridSize +  (*pLRRHYLocation));
+                if (nDistance > 0)
+                        nClosestDistance = nDistance;
 
-        //Keep moving LRRH until she has reached her destination
-	while (1)
-        {
-                //Get the direction to move forward to
-		char cMovingDirection = dequeue (pActionQueue);
-			
-		//Rotate LRRH until it is facing the same specified direction.
-		smartRotateLRRH (pNumOfSenses, 
-                                pNumOfRotations, 
-                                pNumOfMovements, 
-                                pNumOfTurns,
-				pLRRHViewDirection, 
-                                cMovingDirection,
-				pLRRHTile, 
-                                pPlayGrid,
-				nGridSize, 
-                                nStepByStepMode, 
-                                nHasSounds);
-			
-		//Once LRRH is now looking at the right direction, move towards that direction.
-		*pPreviousWalkedTileValue = forwardLRRH (pNumOfMovements, pLRRHXLocation, pLRRHYLocation, pLRRHTile, pLRRHViewDirection, nGridSize, *pPreviousWalkedTileValue);
-		
-                //Split LRRH's current direction to X and Y components
-		int nXDirection = convertDirectionSymbolToXMovement (*pLRRHViewDirection);
-		int nYDirection = convertDirectionSymbolToYMovement (*pLRRHViewDirection);
-		
-                //In the walked tiles array, assign that location as having been walked by LRRH
-		* (pWalkedTiles +  (*pLRRHXLocation) * nGridSize +  (*pLRRHYLocation)) = 1;
-		
-                //Move the pointer of LRRH to her new location
-                pLRRHTile = pLRRHTile + nXDirection * nGridSize + nYDirection;
+                for (i = 0; i < pXGridQueue->nCount && !nCanWalkOnWolf; i++)
+                {
+                        nDistance = narrDistances[pXGridQueue->pArray[i] * nGridSize + pYGridQueue->pArray[i]];
 
-                //Get the pointer to the wolf tile. 
-		int * pWolfTile = pSensedTiles + *pWolfXCoord * nGridSize + *pWolfYCoord;
-		
-		/*After moving, check if LRRH is on a special tile  
-                  (Flower, Bakery, Woodsman, Wolf w/ Bread).
-                  Then, assign the booleans to say that she has walked over that tile already
-		*/
-                switch (*pPreviousWalkedTileValue){
-		case FLOWER_TILE:
-			*pHasFlower = 1;
-			break;
-		case BAKERY_TILE:
-			*pHasBread = 1;
+                        if (nDistance > 0 && (nClosestDistance == -1 || nDistance < nClosestDistance)){
+                                nClosestIndex = i;
+                                nClosestDistance = nDistance;
+                        }
+                }
+        }
 
-                        /*If LRRH has sensed the wolf and has gotten bread, 
-                        assign a positive value so that it is possible for her to pass the wolf */
-			if (nHasSensedWolf) 
-                                *pWolfTile = WOLF_TILE_VALUE;
-			*pWasBreadTaken = 0;
-			break;
-		case WOODSMAN_TILE:
-			*pVisitedWoodsman = 1;
-			
-                        //Proceed to calculate the distance from the woodsman and grandma's house and display it to the user.
-			int nWoodsmanDistance = computeWoodsmanDistance (pPlayGrid, nGridSize);
-			displayWoodsmanLocation (nWoodsmanDistance);
-			break;			
-		case WOLF_TILE:
-			
-                        //If LRRH is on the wolf tile, check whether or not she has bread
+        //If no tile can be reached, prevent the dequeued tile from being reached ever again, and do not generate the path
+        if (nClosestDistance == -1){
+                updateSensedTile (*pNewLRRHXLocation, 
+                                *pNewLRRHYLocation, 
+                                UNWALKABLE_TILE_VALUE, 
+                                pSensedTiles, 
+                                pKnowledge, 
+                                nGridSize);
 
-			if (*pHasBread){
-                                //If she does, she just loses the bread and cannot go to the wolf again
+                *pIsDestinationValid = 0;
+                return;
+        }
 
-				*pHasBread = 0;
-				*pWolfTile = -WOLF_TILE_VALUE;
-				*pWasBreadTaken = 1;
-				displayWolfEatingBread ();
-			} else {
+        //Swap the chosen tile with the dequeued tile, so the dequeued tile can still be explored later on
+        if (nClosestIndex != -1)
+                swapCoordinates (pNewLRRHXLocation, 
+                                &pXGridQueue->pArray[nClosestIndex], 
+                                pNewLRRHYLocation, 
+                                &pYGridQueue->pArray[nClosestIndex]);
 
-                                //If she doesn't, then she dies and the game is lost (break out of the loop later)
-				*pWolfTile = WOLF_TILE_VALUE;
-				*pWasBreadTaken = 0;
-			}
-				break;
-		}		
-		
-		//Display the location and destination of LRRH, as well as the play grid
-		printf ("\nCurrent Location: %d, %d\n", *pLRRHXLocation + 1, *pLRRHYLocation + 1);
-		printf ("Destination: %d, %d\n", nNewLRRHXLocation + 1, nNewLRRHYLocation + 1);
-                
-		displayPlayGrid (pPlayGrid, nGridSize, *pNumOfSenses, *pNumOfRotations, *pNumOfMovements);
-		waitForNextTurn (pNumOfTurns, nStepByStepMode, nHasSounds);
-		
-		//Break out of the loop once the queue has run out  (LRRH has reached the destination)
-		if (*pLRRHXLocation == nNewLRRHXLocation && *pLRRHYLocation == nNewLRRHYLocation){
-			printf ("\nDestination has been reached!\n ");
-                        break;
-		} else if (*pPreviousWalkedTileValue == GRANDMA_TILE || 
-                        (*pWasBreadTaken == 0 && *pPreviousWalkedTileValue == WOLF_TILE))
-                        break;	
+        //Stores the path that will be generated by LRRH
+	char carrPathGrid[nGridSize][nGridSize];
+        int j;
 
-                        
-	}
-}
+	for (i = 0; i < nGridSize; i++)
+        {
+		for (j = 0; j < nGridSize; j++)
+                {
+                        if (narrDistances[i * nGridSize + j] >= 0)
+                                carrPathGrid[i][j] = SENSED_PATH_TILE;
+                        else
+                                carrPathGrid[i][j] = UNWALKABLE_PATH_TILE;
+                }
+        }
 
+        /*Retrace the path, starting at the chosen tile. Each step goes to an adjacent tile that is one move closer to LRRH.
+          The direction of the previous step is tried first, so that LRRH rotates as little as possible.*/
+        int nTracingXLocation = *pNewLRRHXLocation;
+        int nTracingYLocation = *pNewLRRHYLocation;
+        char cPreviousDirection = convertIndexToDirectionSymbol (0);
 
-/* This function allows LRRH to move to a specific location using a generated path while sensing the tiles adjacent to her.
-        @param   (int *)  pLRRHXLocation is the pointer to nLRRHXLocation (LRRH's X Location)
-        @param   (int *)  pLRRHYLocation is the pointer to nLRRHYLocation (LRRH's Y Location)
+        while (narrDistances[nTracingXLocation * nGridSize + nTracingYLocation] > 0)
+        {
+                int nTracingDistance = narrDistances[nTracingXLocation * nGridSize + nTracingYLocation];
+                char cTracingDirection = cPreviousDirection;
+                int nDirection;
 
-        @param   (int)  nNewLRRHXLocation is the pointer to nLRRHXLocation (LRRH's X Location)
-        @param   (int)  nNewLRRHYLocation is the pointer to nLRRHYLocation (LRRH's Y Location)
+                for (nDirection = -1; nDirection < NUM_OF_DIRECTIONS; nDirection++)
+                {
+                        //Try the previous direction first (-1), then every direction
+                        if (nDirection != -1)
+                                cTracingDirection = convertIndexToDirectionSymbol (nDirection);
 
-        @param   (int *)  pWolfXCoord is the pointer to nWolfXCoord (Wolf's X Location)
-        @param   (int *)  pWolfYCoord is the pointer to nWolfYCoord (Wolf's Y Location)
+                        //The tile LRRH would come from when moving in this direction
+                        int nFromXLocation = nTracingXLocation - convertDirectionSymbolToXMovement (cTracingDirection);
+                        int nFromYLocation = nTracingYLocation - convertDirectionSymbolToYMovement (cTracingDirection);
 
-        @param   (Queue *)  pActionQueue is the pointer to ActionQueue
-                (The queue which stores the actions LRRH will execute later on)
-        @param   (Queue *)  pXGridQueue is the pointer to XGridQueue
-                (The queue which stores the X coordinates of the locations to explore later on)
-        @param   (Queue *)  pYGridQueue is the pointer to YGridQueue 
-                (The queue which stores the Y coordinates of the locations to explore later on)
+                        if (isLocationValid (nFromXLocation, nFromYLocation, nGridSize - 1) &&
+                            narrDistances[nFromXLocation * nGridSize + nFromYLocation] == nTracingDistance - 1)
+                                break;
+                }
 
-        @param   (int *)  pNumOfSenses is the pointer to nNumOfSenses (Keeps track of LRRH's sense count)
-        @param   (int *)  pNumOfRotations is the pointer to nNumOfRotations (Keeps track of LRRH's rotation count)
-        @param   (int *)  pNumOfMovements is the pointer to nNumOfMovements (Keeps track of LRRH's movement count)
-        @param   (int *)  pNumOfTurns is the pointer to nNumOfTurns (Keeps track of LRRH's turn count)
+                //Show the direction used on the final path, then store it and move opposite that direction
+                carrPathGrid[nTracingXLocation][nTracingYLocation] = cTracingDirection;
+                enqueue (pActionQueue, (int) cTracingDirection);
 
-        @param   (int)  nGridSize is the size of the playing grid
+                nTracingXLocation -= convertDirectionSymbolToXMovement (cTracingDirection);
+                nTracingYLocation -= convertDirectionSymbolToYMovement (cTracingDirection);
+                cPreviousDirection = cTracingDirection;
+        }
 
-        @param   (char *)  pPlayGrid is the pointer to carrPlayGrid
-        @param   (int *)  pWalkedTiles is the pointer to the narrWalkedTiles Array 
-                (Contains information on which tiles LRRH has already walked on)
-        @param   (int *)  pSensedTiles is the pointer to the narrSensedTiles Array 
-                (Contains information on which tiles LRRH has already sensed)
+        //Set the destination as valid, as the path has reached the starting point
+        *pIsDestinationValid = 1;
+
+        //Reverse the order of directions in the action queue, as the path was retraced from the destination
+        reverseQueue (pActionQueue);
+
+        //Display the play grid and Path generation to the user
+        printf ("\n");
+        displayDivider ();
+        printf ("\nStarting BFS wave\n");
+        printf ("Current Location: %d, %d\n", nLRRHXLocation + 1, nLRRHYLocation + 1);
+        printf ("Destination: %d, %d\n", *pNewLRRHXLocation + 1, *pNewLRRHYLocation + 1);
+        displayDivider ();
+        printf ("\n");
+        displayPlayAndPathGrid (pPlayGrid, &carrPathGrid[0][0], nGridSize, pActionQueue->pArray, pActionQueue->nCount);
+}
 
-        @param   (int *)  pHasFlower is the pointer to nHasFlower 
-                (Tells whether or not LRRH already has went to a flower field)
-        @param   (int *)  pHasBread is the pointer to nHasBread 
-                (Tells whether or not LRRH already has went to a bakery and the bread has not been eaten yet)
-        @param   (int *)  pVisitedWoodsman is the pointer to nHasBread 
-                (Tells whether or not LRRH already has visited the woodsman's house)
 
-        @param   (int *)  pWasBreadTaken is the pointer to nWasBreadTaken 
-                (Tells whether or not LRRH's bread was recently taken by the wolf last turn)
 
-        @param   (int *)  pHasSensedBread is the pointer to nHasSensedBread 
-                (Tells whether or not LRRH has already spotted a bakery)
-        @param   (int *)  pHasSensedFlower is the pointer to nHasSensedFlower 
-                (Tells whether or not LRRH has already spotted a flower field)
-        @param   (int *)  pHasSensedWoodsman is the pointer to nHasSensedWoodsman 
-                (Tells whether or not LRRH has already spotted the woodsman's house)
-        @param   (int *)  pHasSensedGrandma is the pointer to nHasSensedGrandma 
-                (Tells whether or not LRRH has already spotted granny's house)
+/* This function chooses which objective LRRH should go to next (a flower field, the woodsman's house, or a bakery).
 
-        @param   (int *)  pIsGrannyApproachable is the pointer to nIsGrannyApproachable 
-                (Tells whether or not LRRH has all objectives already complete to go to granny's house)
+        Once several objectives have been sensed, going to them in the order they were sensed is not always the shortest.
+        Every order of the objectives LRRH still needs is tried, along with every flower field and bakery she could use,
+        and the order with the least total number of moves wins. If granny's house has been sensed and the order
+        completes every objective, the trip to granny's house is counted as well.
 
-        @param   (char *)  pLRRHViewDirection is the pointer to cLRRHviewDirection (LRRH's viewing direction)
-        @param   (char *)  pPreviousWalkedTileValue is the pointer to cPreviousWalkedTileValue 
-                (The previous value of the tile LRRH is standing)
+        The distances are the walking distances on the walkable tiles LRRH has sensed, computed with a bitboard flood fill
+        from each stop. If one stop cannot be reached from another, the trip is given a very high cost instead.
 
-        @param   (int)  nStepByStepMode tells whether or not to wait for user input until the next turn
-        @param   (int)  nHasSounds tells whether or not the application should play sound for each turn 
-        
-        @return  (void) no return value
-*/
-void 
-moveLRRHToPathWhileSensing (int * pLRRHXLocation, 
-                                int * pLRRHYLocation,
-                                int nNewLRRHXLocation, 
-                                int nNewLRRHYLocation,
-                                int * pWolfXCoord, 
-                                int * pWolfYCoord,
-                                Queue * pActionQueue,
-                                Queue * pXGridQueue, 
-                                Queue * pYGridQueue,
-                                int * pNumOfSenses, 
-                                int * pNumOfRotations, 
-                                int * pNumOfMovements, 
-                                int * pNumOfTurns, 
-                                int nGridSize, 
-                                char * pPlayGrid, 
-                                int * pWalkedTiles, 
-                                int * pSensedTiles,
-                                int * pHasFlower, 
-                                int * pHasBread, 
-                                int * pVisitedWoodsman, 
-                                int * pWasBreadTaken,
-                                int * pHasSensedBread, 
-                                int * pHasSensedFlower, 
-                                int * pHasSensedWoodsman, 
-                                int * pHasSensedGrandma, 
-                                int * pIsGrannyApproachable,
-                                char * pLRRHViewDirection, 
-                                char * pPreviousWalkedTileValue, 
-                                int nStepByStepMode, 
-                                int nHasSounds)
-{	
-	
-        //Check first whether or not LRRH has sensed the wolf
-	int nHasSensedWolf;
+        Since there are at most 3 kinds of objectives, there are at most 6 orders to try for each choice of flower field and bakery.
 
-	if (*pWolfXCoord == -1 && *pWolfYCoord == -1) 
-                nHasSensedWolf = 0;
-	else 
-                nHasSensedWolf = 1;
-	
+        @param   (int)  nLRRHXLocation is LRRH's X Location
+        @param   (int)  nLRRHYLocation is LRRH's Y Location
+        @param   (KnowledgeMap *)  pKnowledge is the pointer to Knowledge
+                (The bit planes that mirror the narrSensedTiles and narrWalkedTiles Arrays)
+
+        @param   (int)  nHasFlower tells whether or not LRRH already has went to a flower field
+        @param   (int)  nVisitedWoodsman tells whether or not LRRH already has visited the woodsman's house
+        @param   (int)  nHasBread tells whether or not LRRH already has bread
+        @param   (int)  nCanGetBread tells whether or not LRRH is allowed to go to a bakery yet
+
+        @param   (int *)  pObjectiveXCoord is the pointer to the X coordinate of the chosen objective
+        @param   (int *)  pObjectiveYCoord is the pointer to the Y coordinate of the chosen objective
+        
+        @return  (int) the tile value of the chosen objective (Ex: FLOWER_TILE_VALUE), UNEXPLORED_TILE_VALUE if there is none
+*/
+int 
+chooseNextObjective (int nLRRHXLocation, 
+                        int nLRRHYLocation, 
+                        KnowledgeMap * pKnowledge,
+                        int nHasFlower, 
+                        int nVisitedWoodsman, 
+                        int nHasBread, 
+                        int nCanGetBread,
+                        int * pObjectiveXCoord, 
+                        int * pObjectiveYCoord)
+{
+        int nGridSize = pKnowledge->SensedPlane.nGridSize;
+
+        //The kinds of objectives, in the order LRRH used to go to them
+        Bitboard * parrObjectivePlanes[NUM_OF_OBJECTIVES] = {&pKnowledge->FlowerPlane, 
+                                                                &pKnowledge->WoodsmanPlane, 
+                                                                &pKnowledge->BakeryPlane};
+        int narrObjectiveValues[NUM_OF_OBJECTIVES] = {FLOWER_TILE_VALUE, WOODSMAN_TILE_VALUE, BAKERY_TILE_VALUE};
+        int narrNeedsObjective[NUM_OF_OBJECTIVES] = {!nHasFlower, !nVisitedWoodsman, !nHasBread && nCanGetBread};
+
+        /*Every possible order of 3 objectives. An order of less objectives only uses the orders
+          which leave the unused objectives at the back in their place.*/
+        int narrOrders[6][NUM_OF_OBJECTIVES] = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+
+        //The stops LRRH can go to. The first stop is LRRH's location, and the last one is granny's house if it has been sensed.
+        int narrStopXCoords[MAX_OBJECTIVE_STOPS];
+        int narrStopYCoords[MAX_OBJECTIVE_STOPS];
+        int nNumOfStops = 1;
+
+        //The first stop and number of stops of each kind of objective that LRRH still needs
+        int narrObjectiveKinds[NUM_OF_OBJECTIVES];
+        int narrFirstStops[NUM_OF_OBJECTIVES];
+        int narrNumOfKindStops[NUM_OF_OBJECTIVES];
+        int nNumOfKinds = 0;
+
+        int i, j, k;
+
+        narrStopXCoords[0] = nLRRHXLocation;
+        narrStopYCoords[0] = nLRRHYLocation;
+
+        //Save every sensed tile of each objective LRRH still needs as a stop
+        for (k = 0; k < NUM_OF_OBJECTIVES; k++)
+        {
+                if (!narrNeedsObjective[k] || countBitboardTiles (parrObjectivePlanes[k]) == 0)
+                        continue;
+
+                narrObjectiveKinds[nNumOfKinds] = k;
+                narrFirstStops[nNumOfKinds] = nNumOfStops;
+                narrNumOfKindStops[nNumOfKinds] = 0;
+
+                for (i = 0; i < nGridSize; i++)
+                {
+                        unsigned long long ullRow = parrObjectivePlanes[k]->ullarrRows[i];
+
+                        while (ullRow && narrNumOfKindStops[nNumOfKinds] < JUMBO_MODE_MAX_ELEMENTS)
+                        {
+                                narrStopXCoords[nNumOfStops] = i;
+                                narrStopYCoords[nNumOfStops] = getLowestBitboardRowBit (ullRow);
+                                narrNumOfKindStops[nNumOfKinds]++;
+                                nNumOfStops++;
+
+                                //Clear the bit of the stop that was just saved
+                                ullRow &= ullRow - 1ULL;
+                        }
+                }
+
+                nNumOfKinds++;
+        }
+
+        //If there is no objective LRRH can go to, there is nothing to choose
+        if (nNumOfKinds == 0)
+                return UNEXPLORED_TILE_VALUE;
+
+        //Granny's house is only counted if LRRH will have everything she needs after the last stop
+        int nGrannyStop = -1;
+        int nHasEveryObjective = 1;
+
+        for (k = 0; k < NUM_OF_OBJECTIVES; k++)
+        {
+                int nIsPlanned = 0;
+
+                for (i = 0; i < nNumOfKinds; i++)
+                {
+                        if (narrObjectiveKinds[i] == k)
+                                nIsPlanned = 1;
+                }
+
+                if (narrNeedsObjective[k] && !nIsPlanned)
+                        nHasEveryObjective = 0;
+        }
+
+        //A bakery that cannot be gone to yet still has to be gone to before granny's house
+        if (!nHasBread && !nCanGetBread)
+                nHasEveryObjective = 0;
+
+        if (nHasEveryObjective && countBitboardTiles (&pKnowledge->GrandmaPlane) > 0){
+                nGrannyStop = nNumOfStops;
+                recallSensedTile (GRANDMA_TILE_VALUE, &narrStopXCoords[nGrannyStop], &narrStopYCoords[nGrannyStop], pKnowledge);
+                nNumOfStops++;
+        }
+
+        //Compute the walking distance between every pair of stops
+        int narrDistances[nGridSize * nGridSize];
+        int narrStopDistances[MAX_OBJECTIVE_STOPS][MAX_OBJECTIVE_STOPS];
+        int nUnreachableDistance = nGridSize * nGridSize;
+
+        for (i = 0; i < nNumOfStops; i++)
+        {
+                computeBitboardDistances (&pKnowledge->WalkablePlane, narrStopXCoords[i], narrStopYCoords[i], narrDistances);
+
+                for (j = 0; j < nNumOfStops; j++)
+                {
+                        narrStopDistances[i][j] = narrDistances[narrStopXCoords[j] * nGridSize + narrStopYCoords[j]];
+                }
+        }
+
+        //Stops like granny's house are not walkable, so use the distance the other way around if only that one is known
+        for (i = 0; i < nNumOfStops; i++)
+        {
+                for (j = 0; j < nNumOfStops; j++)
+                {
+                        if (narrStopDistances[i][j] < 0)
+                                narrStopDistances[i][j] = narrStopDistances[j][i];
+                        if (narrStopDistances[i][j] < 0)
+                                narrStopDistances[i][j] = nUnreachableDistance;
+                }
+        }
+
+        //Try every order of the objectives, and every stop for each objective
+        int nLowestDistance = INT_MAX;
+        int nBestStop = -1;
+        int nBestKind = -1;
+        int nOrder;
+
+        for (nOrder = 0; nOrder < 6; nOrder++)
+        {
+                //Skip the orders that move the unused objectives
+                int nIsValidOrder = 1;
+
+                for (i = nNumOfKinds; i < NUM_OF_OBJECTIVES; i++)
+                {
+                        if (narrOrders[nOrder][i] != i)
+                                nIsValidOrder = 0;
+                }
+
+                if (!nIsValidOrder)
+                        continue;
+
+                //Count through every choice of stops, like the digits of a number
+                int narrChoices[NUM_OF_OBJECTIVES] = {0, 0, 0};
+                int nHasChoicesLeft = 1;
+
+                while (nHasChoicesLeft)
+                {
+                        int nTotalDistance = 0;
+                        int nPreviousStop = 0;
+
+                        for (i = 0; i < nNumOfKinds; i++)
+                        {
+                                int nKind = narrOrders[nOrder][i];
+                                int nStop = narrFirstStops[nKind] + narrChoices[nKind];
+
+                                nTotalDistance += narrStopDistances[nPreviousStop][nStop];
+                                nPreviousStop = nStop;
+                        }
+
+                        if (nGrannyStop != -1)
+                                nTotalDistance += narrStopDistances[nPreviousStop][nGrannyStop];
+
+                        //Only take a strictly shorter order, so that ties keep the original order of the objectives
+                        if (nTotalDistance < nLowestDistance){
+                                int nFirstKind = narrOrders[nOrder][0];
+
+                                nLowestDistance = nTotalDistance;
+                                nBestKind = narrObjectiveKinds[nFirstKind];
+                                nBestStop = narrFirstStops[nFirstKind] + narrChoices[nFirstKind];
+                        }
+
+                        //Move on to the next choice of stops
+                        nHasChoicesLeft = 0;
+
+                        for (i = 0; i < nNumOfKinds && !nHasChoicesLeft; i++)
+                        {
+                                narrChoices[i]++;
+
+                                if (narrChoices[i] < narrNumOfKindStops[i])
+                                        nHasChoicesLeft = 1;
+                                else
+                                        narrChoices[i] = 0;
+                        }
+                }
+        }
+
+        *pObjectiveXCoord = narrStopXCoords[nBestStop];
+        *pObjectiveYCoord = narrStopYCoords[nBestStop];
+
+        return narrObjectiveValues[nBestKind];
+}
+
+/* This function allows LRRH to move to a specific location using a generated path.
+        @param   (GameState *)  pGame is the pointer to Game (LRRH, her items, what she knows, and her queues)
+        @param   (int)  nNewLRRHXLocation is the X location of LRRH's destination
+        @param   (int)  nNewLRRHYLocation is the Y location of LRRH's destination
+
+        @return  (void) no return value
+*/
+void 
+moveLRRHToPath (GameState * pGame,
+                int nNewLRRHXLocation, 
+                int nNewLRRHYLocation)
+{
         //Get the current location of LRRH
-	char * pLRRHTile = (pPlayGrid +  (*pLRRHXLocation) * nGridSize +  (*pLRRHYLocation));
+	char * pLRRHTile = (pGame->pPlayGrid + pGame->nLRRHXLocation * pGame->nGridSize + pGame->nLRRHYLocation);
 
         //Keep moving LRRH until she has reached her destination
 	while (1)
         {
                 //Get the direction to move forward to
-		char cMovingDirection = dequeue (pActionQueue);
+		char cMovingDirection = dequeue (&pGame->ActionQueue);
 			
 		//Rotate LRRH until it is facing the same specified direction.
-		smartRotateLRRH (pNumOfSenses, 
-                                pNumOfRotations, 
-                                pNumOfMovements, 
-                                pNumOfTurns,
-				pLRRHViewDirection, 
+		smartRotateLRRH (&pGame->nNumOfSenses, 
+                                &pGame->nNumOfRotations, 
+                                &pGame->nNumOfMovements, 
+                                &pGame->nNumOfTurns,
+				&pGame->cLRRHViewDirection, 
                                 cMovingDirection,
 				pLRRHTile, 
-                                pPlayGrid,
-				nGridSize, 
-                                nStepByStepMode, 
-                                nHasSounds);
+                                pGame->pPlayGrid,
+				pGame->nGridSize, 
+                                pGame->nStepByStepMode, 
+                                pGame->nHasSounds);
 			
 		//Once LRRH is now looking at the right direction, move towards that direction.
-		*pPreviousWalkedTileValue = forwardLRRH (pNumOfMovements, pLRRHXLocation, pLRRHYLocation, pLRRHTile, pLRRHViewDirection, nGridSize, *pPreviousWalkedTileValue);
+		pGame->cPreviousWalkedTileValue = forwardLRRH (&pGame->nNumOfMovements, &pGame->nLRRHXLocation, &pGame->nLRRHYLocation, pLRRHTile, &pGame->cLRRHViewDirection, pGame->nGridSize, pGame->cPreviousWalkedTileValue);
 		
                 //Split LRRH's current direction to X and Y components
-		int nXDirection = convertDirectionSymbolToXMovement (*pLRRHViewDirection);
-		int nYDirection = convertDirectionSymbolToYMovement (*pLRRHViewDirection);
+		int nXDirection = convertDirectionSymbolToXMovement (pGame->cLRRHViewDirection);
+		int nYDirection = convertDirectionSymbolToYMovement (pGame->cLRRHViewDirection);
 		
                 //In the walked tiles array, assign that location as having been walked by LRRH
-		* (pWalkedTiles +  (*pLRRHXLocation) * nGridSize +  (*pLRRHYLocation)) = 1;
+		updateWalkedTile (pGame->nLRRHXLocation, pGame->nLRRHYLocation, pGame->pWalkedTiles, pGame->pKnowledge, pGame->nGridSize);
 		
                 //Move the pointer of LRRH to her new location
-                pLRRHTile = pLRRHTile + nXDirection * nGridSize + nYDirection;
+                pLRRHTile = pLRRHTile + nXDirection * pGame->nGridSize + nYDirection;
+
+		/*After moving, check if LRRH is on a special tile  
+                  (Flower, Bakery, Woodsman, Wolf w/ Bread).
+                  Then, assign the booleans to say that she has walked over that tile already
+		*/
+                switch (pGame->cPreviousWalkedTileValue){
+		case FLOWER_TILE:
+			pGame->nHasFlower = 1;
+			break;
+		case BAKERY_TILE:
+			pGame->nHasBread = 1;
+
+                        //Now that LRRH has bread, it is possible for her to pass the wolf
+                        updateWolfTile (pGame->nWolfXCoord, pGame->nWolfYCoord, pGame->nHasBread, pGame->pSensedTiles, pGame->pKnowledge, pGame->nGridSize);
+			pGame->nWasBreadTaken = 0;
+			break;
+		case WOODSMAN_TILE:
+			pGame->nVisitedWoodsman = 1;
+			
+                        //Proceed to calculate the distance from the woodsman and grandma's house and display it to the user.
+			int nWoodsmanDistance = computeWoodsmanDistance (pGame->nLRRHXLocation, pGame->nLRRHYLocation, pGame->pPlayGrid, pGame->nGridSize);
+			displayWoodsmanLocation (nWoodsmanDistance);
+
+                        //Remember the distance, granny's house can only be on the tiles exactly that far from the woodsman
+                        updateGrannyRing (pGame->nLRRHXLocation, pGame->nLRRHYLocation, nWoodsmanDistance, pGame->pKnowledge);
+			break;			
+		case WOLF_TILE:
+			
+                        //If LRRH is on the wolf tile, check whether or not she has bread
+
+			if (pGame->nHasBread){
+                                //If she does, she just loses the bread and cannot go to the wolf again
+
+				pGame->nHasBread = 0;
+				updateWolfTile (pGame->nWolfXCoord, pGame->nWolfYCoord, pGame->nHasBread, pGame->pSensedTiles, pGame->pKnowledge, pGame->nGridSize);
+				pGame->nWasBreadTaken = 1;
+				displayWolfEatingBread ();
+			} else {
+
+                                //If she doesn't, then she dies and the game is lost (break out of the loop later)
+				pGame->nWasBreadTaken = 0;
+			}
+				break;
+		}		
+		
+		//Display the location and destination of LRRH, as well as the play grid
+		printf ("\nCurrent Location: %d, %d\n", pGame->nLRRHXLocation + 1, pGame->nLRRHYLocation + 1);
+		printf ("Destination: %d, %d\n", nNewLRRHXLocation + 1, nNewLRRHYLocation + 1);
+                
+		displayPlayGrid (pGame->pPlayGrid, pGame->nGridSize, pGame->nNumOfSenses, pGame->nNumOfRotations, pGame->nNumOfMovements);
+		waitForNextTurn (&pGame->nNumOfTurns, pGame->nStepByStepMode, pGame->nHasSounds);
+		
+		//Break out of the loop once the queue has run out  (LRRH has reached the destination)
+		if (pGame->nLRRHXLocation == nNewLRRHXLocation && pGame->nLRRHYLocation == nNewLRRHYLocation){
+			printf ("\nDestination has been reached!\n ");
+                        break;
+		} else if (pGame->cPreviousWalkedTileValue == GRANDMA_TILE || 
+                        (pGame->nWasBreadTaken == 0 && pGame->cPreviousWalkedTileValue == WOLF_TILE))
+                        break;	
+                else if (pGame->ActionQueue.nCount == 0)
+                        //The path was cut short by the planning budget, a new path will be generated from here
+                        break;
+
+                        
+	}
+}
+
+
+/* This function allows LRRH to move to a specific location using a generated path while sensing the tiles adjacent to her.
+        @param   (GameState *)  pGame is the pointer to Game (LRRH, her items, what she knows, and her queues)
+        @param   (int)  nNewLRRHXLocation is the X location of LRRH's destination
+        @param   (int)  nNewLRRHYLocation is the Y location of LRRH's destination
+
+        @return  (void) no return value
+*/
+void 
+moveLRRHToPathWhileSensing (GameState * pGame,
+                                int nNewLRRHXLocation, 
+                                int nNewLRRHYLocation)
+{	
+        //Get the current location of LRRH
+	char * pLRRHTile = (pGame->pPlayGrid + pGame->nLRRHXLocation * pGame->nGridSize + pGame->nLRRHYLocation);
 
-                //Get the pointer to the wolf tile. 
-		int * pWolfTile = pSensedTiles + *pWolfXCoord * nGridSize + *pWolfYCoord;
+        //Keep moving LRRH until she has reached her destination
+	while (1)
+        {
+                //Get the direction to move forward to
+		char cMovingDirection = dequeue (&pGame->ActionQueue);
+			
+		//Rotate LRRH until it is facing the same specified direction.
+		smartRotateLRRH (&pGame->nNumOfSenses, 
+                                &pGame->nNumOfRotations, 
+                                &pGame->nNumOfMovements, 
+                                &pGame->nNumOfTurns,
+				&pGame->cLRRHViewDirection, 
+                                cMovingDirection,
+				pLRRHTile, 
+                                pGame->pPlayGrid,
+				pGame->nGridSize, 
+                                pGame->nStepByStepMode, 
+                                pGame->nHasSounds);
+			
+		//Once LRRH is now looking at the right direction, move towards that direction.
+		pGame->cPreviousWalkedTileValue = forwardLRRH (&pGame->nNumOfMovements, &pGame->nLRRHXLocation, &pGame->nLRRHYLocation, pLRRHTile, &pGame->cLRRHViewDirection, pGame->nGridSize, pGame->cPreviousWalkedTileValue);
+		
+                //Split LRRH's current direction to X and Y components
+		int nXDirection = convertDirectionSymbolToXMovement (pGame->cLRRHViewDirection);
+		int nYDirection = convertDirectionSymbolToYMovement (pGame->cLRRHViewDirection);
+		
+                //In the walked tiles array, assign that location as having been walked by LRRH
+		updateWalkedTile (pGame->nLRRHXLocation, pGame->nLRRHYLocation, pGame->pWalkedTiles, pGame->pKnowledge, pGame->nGridSize);
 		
+                //Move the pointer of LRRH to her new location
+                pLRRHTile = pLRRHTile + nXDirection * pGame->nGridSize + nYDirection;
+
 		/*After moving, check if LRRH is on a special tile  
                   (Flower, Bakery, Woodsman, Wolf w/ Bread).
                   Then, assign the booleans to say that she has walked over that tile already
 		*/
-                switch (*pPreviousWalkedTileValue){
+                switch (pGame->cPreviousWalkedTileValue){
 		case FLOWER_TILE:
-			*pHasFlower = 1;
+			pGame->nHasFlower = 1;
 			break;
 		case BAKERY_TILE:
-			*pHasBread = 1;
+			pGame->nHasBread = 1;
 
-                        /*If LRRH has sensed the wolf and has gotten bread, 
-                        assign a positive value so that it is possible for her to pass the wolf */
-			if (nHasSensedWolf) 
-                                *pWolfTile = WOLF_TILE_VALUE;
-			*pWasBreadTaken = 0;
+                        //Now that LRRH has bread, it is possible for her to pass the wolf
+                        updateWolfTile (pGame->nWolfXCoord, pGame->nWolfYCoord, pGame->nHasBread, pGame->pSensedTiles, pGame->pKnowledge, pGame->nGridSize);
+			pGame->nWasBreadTaken = 0;
 			break;
 		case WOODSMAN_TILE:
-			*pVisitedWoodsman = 1;
+			pGame->nVisitedWoodsman = 1;
 			
                         //Proceed to calculate the distance from the woodsman and grandma's house and display it to the user.
-			int nWoodsmanDistance = computeWoodsmanDistance (pPlayGrid, nGridSize);
+			int nWoodsmanDistance = computeWoodsmanDistance (pGame->nLRRHXLocation, pGame->nLRRHYLocation, pGame->pPlayGrid, pGame->nGridSize);
 			displayWoodsmanLocation (nWoodsmanDistance);
+
+                        //Remember the distance, granny's house can only be on the tiles exactly that far from the woodsman
+                        updateGrannyRing (pGame->nLRRHXLocation, pGame->nLRRHYLocation, nWoodsmanDistance, pGame->pKnowledge);
 			break;			
 		case WOLF_TILE:
 			
                         //If LRRH is on the wolf tile, check whether or not she has bread
 
-			if (*pHasBread){
+			if (pGame->nHasBread){
                                 //If she does, she just loses the bread and cannot go to the wolf again
 
-				*pHasBread = 0;
-				*pWolfTile = -WOLF_TILE_VALUE;
-				*pWasBreadTaken = 1;
+				pGame->nHasBread = 0;
+				updateWolfTile (pGame->nWolfXCoord, pGame->nWolfYCoord, pGame->nHasBread, pGame->pSensedTiles, pGame->pKnowledge, pGame->nGridSize);
+				pGame->nWasBreadTaken = 1;
 				displayWolfEatingBread ();
 			} else {
 
                                 //If she doesn't, then she dies and the game is lost (break out of the loop later)
-				*pWolfTile = WOLF_TILE_VALUE;
-				*pWasBreadTaken = 0;
+				pGame->nWasBreadTaken = 0;
 			}
 				break;
 		}
 		
-		//After moving, sense the tiles adjacent to the new tile.
-		senseAndQueueLRRHAdjacentTiles (pLRRHXLocation, 
-                                        pLRRHYLocation,
-                                        pWolfXCoord, 
-                                        pWolfYCoord, 
-                                        pSensedTiles, 
-                                        pPlayGrid, 
-                                        pLRRHViewDirection, 
-                                        nGridSize,
-                                        pNumOfSenses, 
-                                        pNumOfRotations, 
-                                        pNumOfMovements, 
-                                        pNumOfTurns,
-                                        pIsGrannyApproachable, 
-                                        pHasBread, 
-                                        pHasSensedBread, 
-                                        pHasSensedFlower, 
-                                        pHasSensedWoodsman, 
-                                        pHasSensedGrandma,
-                                        pXGridQueue, 
-                                        pYGridQueue, 
-                                        nStepByStepMode, 
-                                        nHasSounds);
+		//After moving, sense the tiles adjacent to the new tile. End the senses facing the next movement of the path.
+                char cNextMoveDirection = EMPTY_TILE;
+
+                if (pGame->ActionQueue.nCount > 0)
+                        cNextMoveDirection = (char) pGame->ActionQueue.pArray[0];
+
+		senseAndQueueLRRHAdjacentTiles (pGame, cNextMoveDirection);
 		
 		
 		//Display the location and destination of LRRH, as well as the play grid
-		printf ("\nCurrent Location: %d, %d\n", *pLRRHXLocation + 1, *pLRRHYLocation + 1);
+		printf ("\nCurrent Location: %d, %d\n", pGame->nLRRHXLocation + 1, pGame->nLRRHYLocation + 1);
 		printf ("Destination: %d, %d\n", nNewLRRHXLocation + 1, nNewLRRHYLocation + 1);
                 
-		displayPlayGrid (pPlayGrid, nGridSize, *pNumOfSenses, *pNumOfRotations, *pNumOfMovements);
-		waitForNextTurn (pNumOfTurns, nStepByStepMode, nHasSounds);
+		displayPlayGrid (pGame->pPlayGrid, pGame->nGridSize, pGame->nNumOfSenses, pGame->nNumOfRotations, pGame->nNumOfMovements);
+		waitForNextTurn (&pGame->nNumOfTurns, pGame->nStepByStepMode, pGame->nHasSounds);
 		
 		//Break out of the loop once the queue has run out  (LRRH has reached the destination)
-		if (*pLRRHXLocation == nNewLRRHXLocation && *pLRRHYLocation == nNewLRRHYLocation){
+		if (pGame->nLRRHXLocation == nNewLRRHXLocation && pGame->nLRRHYLocation == nNewLRRHYLocation){
 			printf ("\nDestination has been reached!\n ");
                         break;
-		} else if (*pPreviousWalkedTileValue == GRANDMA_TILE || 
-                        (*pWasBreadTaken == 0 && *pPreviousWalkedTileValue == WOLF_TILE))
+		} else if (pGame->cPreviousWalkedTileValue == GRANDMA_TILE || 
+                        (pGame->nWasBreadTaken == 0 && pGame->cPreviousWalkedTileValue == WOLF_TILE))
                         break;	
+                else if (pGame->ActionQueue.nCount == 0)
+                        //The path was cut short by the planning budget, a new path will be generated from here
+                        break;
 
                         
 	}
 }
 
-/* This function updates the number of turns while waiting either for a next time or until the user presses the ENTER button
-        
-        @param   (int *)  pNumOfTurns is the pointer to nNumOfTurns (Keeps track of LRRH's turn count)
+/* This function removes the tiles LRRH is done with from the queue and sorts the rest, 
+   so that the tile at the front of the queue is the next one LRRH will explore.
+        @param   (Queue *)  pXGridQueue is the pointer to XGridQueue (The queue that stores the X coordinates)
+        @param   (Queue *)  pYGridQueue is the pointer to YGridQueue (The queue that stores the Y coordinates)
 
-        @param   (int)  nStepByStepMode tells whether or not to wait for user input until the next turn
-        @param   (int)  nHasSounds tells whether or not the application should play sound for each turn 
+        @param   (int)  nLRRHXLocation is LRRH's X Location
+        @param   (int)  nLRRHYLocation is LRRH's Y Location
+
+        @param   (int *)  pWalkedTiles is the pointer to the narrWalkedTiles Array 
+                (Contains information on which tiles LRRH has already walked on)
+        @param   (KnowledgeMap *)  pKnowledge is the pointer to Knowledge
+                (The bit planes that mirror the narrSensedTiles and narrWalkedTiles Arrays)
+
+        @param   (int)  nGridSize is the size of the playing grid
+        @param   (int)  nFrontierMode tells how LRRH will pick the next tile to explore
+        @param   (int)  nSensingMode tells whether LRRH senses every adjacent tile or defers some of them while walking
         
         @return  (void) no return value
 */
-void 
-waitForNextTurn (int * pNumOfTurns, int nStepByStepMode, int nHasSounds)
+void
+orderFrontierQueue (Queue * pXGridQueue, 
+                        Queue * pYGridQueue, 
+                        int nLRRHXLocation, 
+                        int nLRRHYLocation, 
+                        int * pWalkedTiles, 
+                        KnowledgeMap * pKnowledge, 
+                        int nGridSize, 
+                        int nFrontierMode, 
+                        int nSensingMode)
 {
-        //Increment the number of turns
-	*pNumOfTurns += 1;
-	
-        //If step-by-step mode is enabled, wait for the user to press the ENTER button before executing the next turn 
-	if (nStepByStepMode) {
-		printf ("\nPress ENTER to start turn %d.\n", *pNumOfTurns);
-		getchar ();
+        //If the current queue count is greater than 1, then remove tiles already walked on by LRRH from the queue.
+        //(In deferred sensing mode, walked tiles with neighbors left to sense are kept, and only fully explored tiles are removed)
+        //Also, sort the coordinates in the queue by distance (or by what LRRH can learn for the distance)
+	if (pXGridQueue->nCount > 1){
+                if (nSensingMode == SENSING_MODE_DEFERRED)
+                        removeExploredCoordinatesFromQueue (pXGridQueue, pYGridQueue, pKnowledge);
+                else
+		        removeWalkedCoordinatesFromQueue (pXGridQueue, pYGridQueue, pWalkedTiles, nGridSize);
+
+                if (nFrontierMode == FRONTIER_MODE_INFORMATION_GAIN)
+                        sortCoordinatesByInformationGain (pXGridQueue, pYGridQueue, nLRRHXLocation, nLRRHYLocation, pKnowledge);
+                else
+		        sortCoordinatesByDistance (pXGridQueue, pYGridQueue, nLRRHXLocation, nLRRHYLocation);
+
+                //If the woodsman has given his hint, explore the tiles where granny's house can be first
+                prioritizeGrannyRingCoordinates (pXGridQueue, pYGridQueue, pKnowledge);
 	}
-	
-        //If sounds are enabled, play a beep. else, sleep for a while
-	if (nHasSounds)
-                playAlertSound (); 
-        else 
-                Sleep (500);
-	
-        //Print the number of turns
-	printf ("\nTURN %d\n", *pNumOfTurns);
-	
-        //Place a divider
-	displayDivider ();
 }
 
-/* This function updates the number of turns while waiting either for a next time or until the user presses the ENTER button
-        
+//The plan to work on during the pauses between turns (NULL if there is nothing to plan)
+static SpeculativePlan * pPendingSpeculativePlan = NULL;
+
+/* This function initializes a speculative plan, which plans the path to the next tile in the queue
+   on a worker thread while the game is paused between turns.
+        @param   (SpeculativePlan *)  pPlan is the pointer to Plan
+        @param   (int *)  pLRRHXLocation is the pointer to nLRRHXLocation (LRRH's X Location)
+        @param   (int *)  pLRRHYLocation is the pointer to nLRRHYLocation (LRRH's Y Location)
+        @param   (char *)  pLRRHViewDirection is the pointer to cLRRHviewDirection (LRRH's viewing direction)
+
+        @param   (Queue *)  pXGridQueue is the pointer to XGridQueue (The queue that stores the X coordinates)
+        @param   (Queue *)  pYGridQueue is the pointer to YGridQueue (The queue that stores the Y coordinates)
+
         @param   (int *)  pSensedTiles is the pointer to the narrSensedTiles Array 
                 (Contains information on which tiles LRRH has already sensed)
+        @param   (int *)  pWalkedTiles is the pointer to the narrWalkedTiles Array 
+                (Contains information on which tiles LRRH has already walked on)
+        @param   (KnowledgeMap *)  pKnowledge is the pointer to Knowledge
+                (The bit planes that mirror the narrSensedTiles and narrWalkedTiles Arrays)
+        @param   (PlanningBudget *)  pBudget is the pointer to Budget 
+                (The number of states the path generation can check in a turn)
+
         @param   (int)  nGridSize is the size of the playing grid
+        @param   (int)  nFrontierMode tells how LRRH will pick the next tile to explore
+        @param   (int)  nSensingMode tells whether LRRH senses every adjacent tile or defers some of them while walking
         
-        @return  (int) Gives a 0 if not every tile has been sensed, and a 1 if every tile has been sensed
+        @return  (void) no return value
 */
-int 
-sensedEveryTile (int * pSensedTiles, int nGridSize)
+void
+initSpeculativePlan (SpeculativePlan * pPlan,
+                        int * pLRRHXLocation,
+                        int * pLRRHYLocation,
+                        char * pLRRHViewDirection,
+                        Queue * pXGridQueue, 
+                        Queue * pYGridQueue,
+                        int * pSensedTiles, 
+                        int * pWalkedTiles,
+                        KnowledgeMap * pKnowledge,
+                        PlanningBudget * pBudget,
+                        int nGridSize,
+                        int nFrontierMode,
+                        int nSensingMode)
 {
-	//Loop through the sensed tiles array
-	int i, j;
-	for (i = 0; i < nGridSize; i++)
-        {
-		for (j = 0; j < nGridSize; j++)
-                {		
-			//If there is a tile that is yet to be sensed, return 0.
-			if (* (pSensedTiles + i * nGridSize + j) == 0)
-			        return 0;							
-		}
-	}
-	
-	//If you have not found one, return true
-	return 1;
+        pPlan->pLRRHXLocation = pLRRHXLocation;
+        pPlan->pLRRHYLocation = pLRRHYLocation;
+        pPlan->pLRRHViewDirection = pLRRHViewDirection;
+        pPlan->pXGridQueue = pXGridQueue;
+        pPlan->pYGridQueue = pYGridQueue;
+        pPlan->pSensedTiles = pSensedTiles;
+        pPlan->pWalkedTiles = pWalkedTiles;
+        pPlan->pKnowledge = pKnowledge;
+        pPlan->pBudget = pBudget;
+        pPlan->nGridSize = nGridSize;
+        pPlan->nFrontierMode = nFrontierMode;
+        pPlan->nSensingMode = nSensingMode;
+
+        pPlan->nShouldOrderQueue = 0;
+        pPlan->nHasPlan = 0;
+        pPlan->hWorkerThread = NULL;
+
+        initQueue (&pPlan->ActionQueue);
 }
 
-/* This function assigns the X and Y coordinates of a specific element that has already been sensed by LRRH. 
-   Akin to LRRH remembering where something is.
+/* This function frees the memory used by a speculative plan
+        @param   (SpeculativePlan *)  pPlan is the pointer to Plan
         
-        @param   (int)  nSenseValue is the sense value that is being recalled
+        @return  (void) no return value
+*/
+void
+clearSpeculativePlan (SpeculativePlan * pPlan)
+{
+        //Make sure that no worker thread is still using the plan
+        if (pPendingSpeculativePlan == pPlan)
+                finishSpeculativePlan ();
 
-        @param   (int *)  pXCoord is the pointer to the variable that will contain the X coordinate of the recalled element
-        @param   (int *)  pYCoord is the pointer to the variable that will contain the Y coordinate of the recalled element
+        setPendingSpeculativePlan (NULL, 0);
+        clearQueue (&pPlan->ActionQueue);
+        pPlan->nHasPlan = 0;
+}
 
-        @param   (int *)  pSensedTiles is the pointer to the narrSensedTiles Array 
-                (Contains information on which tiles LRRH has already sensed)
-        @param   (int)  nGridSize is the size of the playing grid
+/* This function chooses which plan to work on during the pauses between turns
+        @param   (SpeculativePlan *)  pPlan is the pointer to Plan (NULL to stop planning during the pauses)
+        @param   (int)  nShouldOrderQueue tells whether or not the queue will be sorted before LRRH goes to its front tile
+                (While LRRH walks a path, the queue is only sorted once she gets to the end of it)
         
         @return  (void) no return value
 */
-void recallSensedTile (int nSenseValue, int * pXCoord, int * pYCoord, int * pSensedTiles, int nGridSize){
-	int nSearchForNegatives;
-	
-        //Also search for the negative values of the wolf and grandma tile if those are the targets
- 	if (nSenseValue == WOLF_TILE_VALUE || 
-                nSenseValue == -WOLF_TILE_VALUE || 
-                nSenseValue == GRANDMA_TILE_VALUE || 
-                nSenseValue == -GRANDMA_TILE_VALUE)
-	{
-		nSearchForNegatives = 1;
-	} else 
-                nSearchForNegatives = 0;
-	
-	
-	int i,j;
+void
+setPendingSpeculativePlan (SpeculativePlan * pPlan, int nShouldOrderQueue)
+{
+        pPendingSpeculativePlan = pPlan;
 
-        //Loop through the sensed tiles array
-	for (i = 0; i < nGridSize; i++)
+        if (pPlan != NULL)
+                pPlan->nShouldOrderQueue = nShouldOrderQueue;
+}
+
+/* This function copies the current state of the game into the pending plan, 
+   then starts a worker thread to plan the path to the tile at the front of the queue.
+   Nothing is planned if there is no pending plan, or if LRRH is already on the tile at the front of the queue.
+        
+        @return  (void) no return value
+*/
+void
+startSpeculativePlan ()
+{
+        SpeculativePlan * pPlan = pPendingSpeculativePlan;
+
+        if (pPlan == NULL)
+                return;
+
+        pPlan->nHasPlan = 0;
+
+        if (pPlan->pXGridQueue->nCount == 0)
+                return;
+
+        //The next tile LRRH will go to is the one at the front of the queue
+        pPlan->nStartXCoord = *pPlan->pLRRHXLocation;
+        pPlan->nStartYCoord = *pPlan->pLRRHYLocation;
+        pPlan->cStartDirection = *pPlan->pLRRHViewDirection;
+        pPlan->nDestinationXCoord = pPlan->pXGridQueue->pArray[0];
+        pPlan->nDestinationYCoord = pPlan->pYGridQueue->pArray[0];
+
+        //If the queue will be sorted first, sort a copy of it to find out which tile will be at the front
+        if (pPlan->nShouldOrderQueue){
+                Queue XGridQueue, YGridQueue;
+                int i;
+
+                initQueue (&XGridQueue);
+                initQueue (&YGridQueue);
+
+                for (i = 0; i < pPlan->pXGridQueue->nCount; i++)
+                {
+                        enqueue (&XGridQueue, pPlan->pXGridQueue->pArray[i]);
+                        enqueue (&YGridQueue, pPlan->pYGridQueue->pArray[i]);
+                }
+
+                orderFrontierQueue (&XGridQueue, 
+                                        &YGridQueue, 
+                                        pPlan->nStartXCoord, 
+                                        pPlan->nStartYCoord, 
+                                        pPlan->pWalkedTiles, 
+                                        pPlan->pKnowledge, 
+                                        pPlan->nGridSize, 
+                                        pPlan->nFrontierMode, 
+                                        pPlan->nSensingMode);
+
+                int nHasNextTile = XGridQueue.nCount > 0;
+
+                if (nHasNextTile){
+                        pPlan->nDestinationXCoord = XGridQueue.pArray[0];
+                        pPlan->nDestinationYCoord = YGridQueue.pArray[0];
+                }
+
+                clearQueue (&XGridQueue);
+                clearQueue (&YGridQueue);
+
+                if (!nHasNextTile)
+                        return;
+        }
+
+        if (pPlan->nStartXCoord == pPlan->nDestinationXCoord && pPlan->nStartYCoord == pPlan->nDestinationYCoord)
+                return;
+
+        /*The worker thread only uses its own copy of what LRRH knows, as the path generation changes the sensed tiles.
+          The first copy is kept as it is, to check later on whether or not LRRH has learned anything new since.*/
+        int nSizeOfTiles = pPlan->nGridSize * pPlan->nGridSize * sizeof (int);
+
+        memcpy (pPlan->narrSensedTiles, pPlan->pSensedTiles, nSizeOfTiles);
+        memcpy (&pPlan->Knowledge, pPlan->pKnowledge, sizeof (KnowledgeMap));
+        memcpy (&pPlan->Budget, pPlan->pBudget, sizeof (PlanningBudget));
+
+        memcpy (pPlan->narrPlannedSensedTiles, pPlan->narrSensedTiles, nSizeOfTiles);
+        memcpy (&pPlan->PlannedKnowledge, &pPlan->Knowledge, sizeof (KnowledgeMap));
+        memcpy (&pPlan->PlannedBudget, &pPlan->Budget, sizeof (PlanningBudget));
+
+        pPlan->hWorkerThread = CreateThread (NULL, 0, runSpeculativePlan, pPlan, 0, NULL);
+
+        //If the thread could not be made, there is no plan, and the path will simply be generated later on
+        if (pPlan->hWorkerThread != NULL)
+                pPlan->nHasPlan = 1;
+}
+
+/* This function is run by the worker thread. It plans the path using the copy of the state in the plan.
+        @param   (LPVOID)  pParameter is the pointer to the plan
+        
+        @return  (DWORD) always returns 0
+*/
+DWORD WINAPI
+runSpeculativePlan (LPVOID pParameter)
+{
+        SpeculativePlan * pPlan = (SpeculativePlan *) pParameter;
+
+        searchAStarPath (pPlan->nStartXCoord, 
+                                pPlan->nStartYCoord, 
+                                pPlan->cStartDirection,
+                                pPlan->nDestinationXCoord, 
+                                pPlan->nDestinationYCoord, 
+                                pPlan->narrPlannedSensedTiles, 
+                                &pPlan->PlannedKnowledge,
+                                pPlan->nGridSize, 
+                                &pPlan->ActionQueue, 
+                                &pPlan->nIsDestinationValid,
+                                &pPlan->PlannedBudget,
+                                pPlan->carrPathGrid,
+                                &pPlan->nPathEndState);
+
+        return 0;
+}
+
+/* This function waits for the worker thread of the pending plan to finish
+        
+        @return  (void) no return value
+*/
+void
+finishSpeculativePlan ()
+{
+        SpeculativePlan * pPlan = pPendingSpeculativePlan;
+
+        if (pPlan == NULL || pPlan->hWorkerThread == NULL)
+                return;
+
+        WaitForSingleObject (pPlan->hWorkerThread, INFINITE);
+        CloseHandle (pPlan->hWorkerThread);
+        pPlan->hWorkerThread = NULL;
+}
+
+/* This function uses the path planned during the pause instead of generating it again, 
+   but only if nothing the plan depended on has changed since the pause started.
+   The path is displayed the same way as generateAStarPath would have.
+        @param   (SpeculativePlan *)  pPlan is the pointer to Plan
+
+        @param   (int)  nNewLRRHXLocation is the X coordinate of the destination
+        @param   (int)  nNewLRRHYLocation is the Y coordinate of the destination
+
+        @param   (char *)  pPlayGrid is the pointer to carrPlayGrid
+
+        @param   (Queue *)  pActionQueue is the pointer to ActionQueue
+                (The queue which stores the actions LRRH will execute later on)
+
+        @param   (int *)  pIsDestinationValid is the pointer to nIsDestinationValid
+        
+        @return  (int) returns 1 if the planned path was used, 0 if the path still has to be generated
+*/
+int
+adoptSpeculativePlan (SpeculativePlan * pPlan,
+                        int nNewLRRHXLocation, 
+                        int nNewLRRHYLocation,
+                        char * pPlayGrid,
+                        Queue * pActionQueue, 
+                        int * pIsDestinationValid)
+{
+        int nSizeOfTiles = pPlan->nGridSize * pPlan->nGridSize * sizeof (int);
+
+        //Throw away the plan if LRRH is somewhere else, is going somewhere else, or has learned something new since
+        if (!pPlan->nHasPlan ||
+            pPlan->nStartXCoord != *pPlan->pLRRHXLocation ||
+            pPlan->nStartYCoord != *pPlan->pLRRHYLocation ||
+            pPlan->cStartDirection != *pPlan->pLRRHViewDirection ||
+            pPlan->nDestinationXCoord != nNewLRRHXLocation ||
+            pPlan->nDestinationYCoord != nNewLRRHYLocation ||
+            memcmp (pPlan->narrSensedTiles, pPlan->pSensedTiles, nSizeOfTiles) != 0 ||
+            memcmp (&pPlan->Knowledge, pPlan->pKnowledge, sizeof (KnowledgeMap)) != 0 ||
+            memcmp (&pPlan->Budget, pPlan->pBudget, sizeof (PlanningBudget)) != 0){
+                pPlan->nHasPlan = 0;
+                return 0;
+        }
+
+        //Keep the changes the path generation made, as if it was just generated now
+        memcpy (pPlan->pSensedTiles, pPlan->narrPlannedSensedTiles, nSizeOfTiles);
+        memcpy (pPlan->pKnowledge, &pPlan->PlannedKnowledge, sizeof (KnowledgeMap));
+        memcpy (pPlan->pBudget, &pPlan->PlannedBudget, sizeof (PlanningBudget));
+
+        //Copy the planned actions into the action queue
+        int i;
+
+        clearQueue (pActionQueue);
+        initQueue (pActionQueue);
+
+        for (i = 0; i < pPlan->ActionQueue.nCount; i++)
         {
-		for (j = 0; j < nGridSize; j++)
-                {		
-			//Look for unsensed tiles in the sensed tiles
+                enqueue (pActionQueue, pPlan->ActionQueue.pArray[i]);
+        }
 
-                        //If we are searching for negatives, then also consider the negative value of nSenseValue in the array
-			if (nSearchForNegatives){
-                                //If the sense value has been found, save the coordinates and break
-				if ( (*(pSensedTiles + i * nGridSize + j) == nSenseValue ||
-                                        *(pSensedTiles + i * nGridSize + j) == nSenseValue * -1)){
-					
-					//Found an instance of the tile we were searching for
-					*pXCoord = i;
-					*pYCoord = j;
-					break;
-				}	
-			} else {
-                        //If not, consider only the positive value.
-                                //If the sense value has been found, save the coordinates and break
-				if (*(pSensedTiles + i * nGridSize + j) == nSenseValue){
-				
-					//Found an instance of the tile we were searching for
-					*pXCoord = i;
-					*pYCoord = j;
-					break;
-				}	
-			}						
-		}
+        *pIsDestinationValid = pPlan->nIsDestinationValid;
+
+        if (*pIsDestinationValid)
+                displayAStarPath (pPlan->nStartXCoord, 
+                                        pPlan->nStartYCoord, 
+                                        nNewLRRHXLocation, 
+                                        nNewLRRHYLocation, 
+                                        pPlan->nPathEndState,
+                                        pPlayGrid, 
+                                        pPlan->carrPathGrid, 
+                                        pPlan->nGridSize, 
+                                        pActionQueue);
+
+        pPlan->nHasPlan = 0;
+        return 1;
+}
+
+/* This function updates the number of turns while waiting either for a next time or until the user presses the ENTER button
+        
+        @param   (int *)  pNumOfTurns is the pointer to nNumOfTurns (Keeps track of LRRH's turn count)
+
+        @param   (int)  nStepByStepMode tells whether or not to wait for user input until the next turn
+        @param   (int)  nHasSounds tells whether or not the application should play sound for each turn 
+        
+        @return  (void) no return value
+*/
+void 
+waitForNextTurn (int * pNumOfTurns, int nStepByStepMode, int nHasSounds)
+{
+        //Increment the number of turns
+	*pNumOfTurns += 1;
+	
+        //Use the pause to plan the next path on a worker thread
+        startSpeculativePlan ();
+
+        //If step-by-step mode is enabled, wait for the user to press the ENTER button before executing the next turn 
+	if (nStepByStepMode) {
+		printf ("\nPress ENTER to start turn %d.\n", *pNumOfTurns);
+		getchar ();
 	}
 	
+        //If sounds are enabled, play a beep. else, sleep for a while
+	if (nHasSounds)
+                playAlertSound (); 
+        else 
+                Sleep (500);
+
+        //The plan has to be done before LRRH does anything that can change what she knows
+        finishSpeculativePlan ();
+	
+        //Print the number of turns
+	printf ("\nTURN %d\n", *pNumOfTurns);
+	
+        //Place a divider
+	displayDivider ();
+}
+
+/* This function checks whether or not LRRH has already sensed every tile in the playing grid.
+   Instead of checking each tile, each row of the sensed plane is compared to a full row at once.
+        
+        @param   (KnowledgeMap *)  pKnowledge is the pointer to Knowledge
+                (The bit planes that mirror the narrSensedTiles and narrWalkedTiles Arrays)
+        
+        @return  (int) Gives a 0 if not every tile has been sensed, and a 1 if every tile has been sensed
+*/
+int 
+sensedEveryTile (KnowledgeMap * pKnowledge)
+{
+        int nGridSize = pKnowledge->SensedPlane.nGridSize;
+        unsigned long long ullFullRow = getBitboardRowMask (nGridSize);
+
+	//Loop through the rows of the sensed plane
+	int i;
+	for (i = 0; i < nGridSize; i++)
+        {
+		//If there is a tile in the row that is yet to be sensed, return 0.
+		if (pKnowledge->SensedPlane.ullarrRows[i] != ullFullRow)
+		        return 0;
+	}
+	
+	//If you have not found one, return true
+	return 1;
 }
 
 /* This function assigns the X and Y coordinates of a specific element that has already been sensed by LRRH. 
    Akin to LRRH remembering where something is.
         
+        @param   (int)  nSenseValue is the sense value that is being recalled
+
+        @param   (int *)  pXCoord is the pointer to the variable that will contain the X coordinate of the recalled element
+        @param   (int *)  pYCoord is the pointer to the variable that will contain the Y coordinate of the recalled element
+
+        @param   (KnowledgeMap *)  pKnowledge is the pointer to Knowledge
+                (The bit planes that mirror the narrSensedTiles and narrWalkedTiles Arrays)
+        
+        @return  (void) no return value
+*/
+void recallSensedTile (int nSenseValue, int * pXCoord, int * pYCoord, KnowledgeMap * pKnowledge){
+        //Get the bit plane of the element that is being recalled
+        Bitboard * pObjectPlane = getKnowledgePlane (pKnowledge, nSenseValue);
+
+        if (pObjectPlane == NULL)
+                return;
+
+	int i;
+
+        /*Look for the last row that has the element in it, and pick the first tile of that row.
+          Empty rows are skipped entirely, so only the rows holding the element are ever looked at.*/
+	for (i = pObjectPlane->nGridSize - 1; i >= 0; i--)
+        {
+                if (pObjectPlane->ullarrRows[i] != 0){
+
+                        //Found an instance of the tile we were searching for
+                        *pXCoord = i;
+                        *pYCoord = getLowestBitboardRowBit (pObjectPlane->ullarrRows[i]);
+                        break;
+                }
+	}
+	
+}
+
+/* This function checks whether or not LRRH can skip going to the wolf's tile for now.
+        
         @param   (int)  nLRRHXLocation is LRRH's X Location
         @param   (int)  nLRRHYLocation is LRRH's Y Location
 
         @param   (int)  nWolfXCoord is Wolf's X Location
         @param   (int)  nWolfYCoord is Wolf's Y Location
 
-        @param   (int *)  pSensedTiles is the pointer to the narrSensedTiles Array 
-                (Contains information on which tiles LRRH has already sensed)
+        @param   (KnowledgeMap *)  pKnowledge is the pointer to Knowledge
+                (The bit planes that mirror the narrSensedTiles and narrWalkedTiles Arrays)
 
-        @param   (int)  nGridSize is the size of the playing grid
         @param   (int)  nQueueCapacity is the capacity of the coordinate queues
 
         @return  (int) Gives a 1 if the wolf tile is skippable, and a 0 if not
@@ -1806,41 +2711,52 @@ isWolfTileSkippable (int nLRRHXLocation,
                         int nLRRHYLocation, 
                         int nWolfXCoord, 
                         int nWolfYCoord,
-                        int * pSensedTiles, 
-                        int nGridSize,
+                        KnowledgeMap * pKnowledge,
                         int nQueueCapacity)
 {
         //If the wolf tile is the last one in the queue, then it is unskippable
         if(nQueueCapacity == 0) return 0;
 
-        //Check all of the 8 surrounding tiles around the wolf
-	int narrXDirectionCoordinates[8] = {1, -1, 1, -1, 1, -1, 0, 0};
-	int narrYDirectionCoordinates[8] = {0, 0, 1, 1, -1, -1, 1, -1};
+        int nGridSize = pKnowledge->UnwalkablePlane.nGridSize;
+        unsigned long long ullFullRow = getBitboardRowMask (nGridSize);
+
+        //The 3 tiles of a row around the wolf (the wolf's column and the columns to its left and right)
+        unsigned long long ullWindow = (1ULL << nWolfYCoord);
+
+        if (nWolfYCoord > 0)
+                ullWindow |= (1ULL << (nWolfYCoord - 1));
+        if (nWolfYCoord < nGridSize - 1)
+                ullWindow |= (1ULL << (nWolfYCoord + 1));
+
+        ullWindow &= ullFullRow;
 
 	int i;
         
         //Saves the amount of unwalkable tiles around the wolf
 	int nNumUnwalkableTiles = 0;
 
-        //For each surrounding tile...
-	for (i = 0; i < 8; i++)
+        //Check all of the 8 surrounding tiles around the wolf, one row of 3 tiles at a time
+	for (i = -1; i <= 1; i++)
 	{
-                //Coordinates of the surrounding tile
-		int nXCoord = (nWolfXCoord + narrXDirectionCoordinates[i]);
-		int nYCoord = (nWolfYCoord + narrYDirectionCoordinates[i]);
+                int nXCoord = nWolfXCoord + i;
 
-                //Check if the surrounding tile is a valid location, if not, increment the number of unwalkable tiles
-		if (isLocationValid (nXCoord, nYCoord, nGridSize - 1)){
+                //The wolf's own tile is not one of the surrounding tiles
+                unsigned long long ullRowWindow = ullWindow;
+                int nNumOfRowTiles = 3;
 
-                        //Check the value of the surrounding tile
-			int * pSurroundingTile =  (pSensedTiles + nXCoord * nGridSize + nYCoord);
-			
-                        //If it is unwalkable, increment the number of unwalkable tiles
-                        if (*pSurroundingTile < 0)
-			        nNumUnwalkableTiles++;
-			
-		} else
-			nNumUnwalkableTiles++;
+                if (i == 0){
+                        ullRowWindow &= ~(1ULL << nWolfYCoord);
+                        nNumOfRowTiles = 2;
+                }
+
+                //Surrounding tiles outside of the grid count as unwalkable tiles
+                nNumUnwalkableTiles += nNumOfRowTiles - countBitboardRowBits (ullRowWindow);
+
+                //If the row is inside the grid, count its unwalkable tiles all at once, else all of them are unwalkable
+		if (isLocationValid (nXCoord, nWolfYCoord, nGridSize - 1))
+                        nNumUnwalkableTiles += countBitboardRowBits (pKnowledge->UnwalkablePlane.ullarrRows[nXCoord] & ullRowWindow);
+		else
+			nNumUnwalkableTiles += countBitboardRowBits (ullRowWindow);
 	}
 
         /*If the amount of unwalkable tiles is greater than 1 (Meaning that a line of unwalkable tiles has been formed)
@@ -1851,4 +2767,607 @@ isWolfTileSkippable (int nLRRHXLocation,
                 return 0;
 	else
                 return 1;
-}
\ No newline at end of file
+}
+
+/* This function initializes the bit planes of what LRRH knows about the playing grid. Every plane starts empty.
+        
+        @param   (KnowledgeMap *)  pKnowledge is the pointer to Knowledge
+        @param   (int)  nGridSize is the size of the playing grid
+        
+        @return  (void) no return value
+*/
+void
+initKnowledgeMap (KnowledgeMap * pKnowledge, int nGridSize)
+{
+        clearBitboard (&pKnowledge->SensedPlane, nGridSize);
+        clearBitboard (&pKnowledge->WalkablePlane, nGridSize);
+        clearBitboard (&pKnowledge->UnwalkablePlane, nGridSize);
+        clearBitboard (&pKnowledge->WalkedPlane, nGridSize);
+        clearBitboard (&pKnowledge->FlowerPlane, nGridSize);
+        clearBitboard (&pKnowledge->WoodsmanPlane, nGridSize);
+        clearBitboard (&pKnowledge->BakeryPlane, nGridSize);
+        clearBitboard (&pKnowledge->GrandmaPlane, nGridSize);
+        clearBitboard (&pKnowledge->WolfPlane, nGridSize);
+        clearBitboard (&pKnowledge->GrannyRingPlane, nGridSize);
+
+        //The woodsman has not given his hint yet
+        pKnowledge->nWoodsmanDistance = -1;
+
+        //Every tile is unexplored at the start, so each tile can sense all of its neighbors inside the grid
+        int i, j;
+        for (i = 0; i < nGridSize; i++)
+        {
+                for (j = 0; j < nGridSize; j++)
+                {
+                        pKnowledge->narrUnexploredNeighbors[i * nGridSize + j] = (i > 0) + (i < nGridSize - 1) + 
+                                                                                (j > 0) + (j < nGridSize - 1);
+                }
+        }
+}
+
+/* This function gives the bit plane of a special element given its sense value
+        
+        @param   (KnowledgeMap *)  pKnowledge is the pointer to Knowledge
+        @param   (int)  nSenseValue is the sense value of the element (Its negative value is also accepted)
+        
+        @return  (Bitboard *) the pointer to the bit plane of the element, NULL if the element has no plane
+*/
+Bitboard *
+getKnowledgePlane (KnowledgeMap * pKnowledge, int nSenseValue)
+{
+        switch (abs (nSenseValue)){
+        case FLOWER_TILE_VALUE:
+                return &pKnowledge->FlowerPlane;
+        case WOODSMAN_TILE_VALUE:
+                return &pKnowledge->WoodsmanPlane;
+        case BAKERY_TILE_VALUE:
+                return &pKnowledge->BakeryPlane;
+        case GRANDMA_TILE_VALUE:
+                return &pKnowledge->GrandmaPlane;
+        case WOLF_TILE_VALUE:
+                return &pKnowledge->WolfPlane;
+        default:
+                return NULL;
+        }
+}
+
+/* This function assigns a new value to a tile in the narrSensedTiles Array and updates the bit planes to match it.
+   Every change to the narrSensedTiles Array should go through this function.
+        
+        @param   (int)  nXLocation is the X location of the tile
+        @param   (int)  nYLocation is the Y location of the tile
+        @param   (int)  nSenseValue is the new value of the tile
+
+        @param   (int *)  pSensedTiles is the pointer to the narrSensedTiles Array 
+                (Contains information on which tiles LRRH has already sensed)
+        @param   (KnowledgeMap *)  pKnowledge is the pointer to Knowledge
+                (The bit planes that mirror the narrSensedTiles and narrWalkedTiles Arrays)
+
+        @param   (int)  nGridSize is the size of the playing grid
+        
+        @return  (void) no return value
+*/
+void
+updateSensedTile (int nXLocation, 
+                int nYLocation, 
+                int nSenseValue, 
+                int * pSensedTiles, 
+                KnowledgeMap * pKnowledge, 
+                int nGridSize)
+{
+        int nWasSensed = getBitboardTile (&pKnowledge->SensedPlane, nXLocation, nYLocation);
+        int nIsSensed = nSenseValue != UNEXPLORED_TILE_VALUE;
+
+        *(pSensedTiles + nXLocation * nGridSize + nYLocation) = nSenseValue;
+
+        //If the tile has just been explored (or forgotten), its neighbors have one less (or one more) unexplored neighbor
+        if (nWasSensed != nIsSensed){
+                int nChange = nIsSensed ? -1 : 1;
+                int nDirection;
+
+                for (nDirection = 0; nDirection < NUM_OF_DIRECTIONS; nDirection++)
+                {
+                        char cDirection = convertIndexToDirectionSymbol (nDirection);
+                        int nNeighborXLocation = nXLocation + convertDirectionSymbolToXMovement (cDirection);
+                        int nNeighborYLocation = nYLocation + convertDirectionSymbolToYMovement (cDirection);
+
+                        if (isLocationValid (nNeighborXLocation, nNeighborYLocation, nGridSize - 1))
+                                pKnowledge->narrUnexploredNeighbors[nNeighborXLocation * nGridSize + nNeighborYLocation] += nChange;
+                }
+        }
+
+        setBitboardTile (&pKnowledge->SensedPlane, nXLocation, nYLocation, nIsSensed);
+        setBitboardTile (&pKnowledge->WalkablePlane, nXLocation, nYLocation, nSenseValue > UNEXPLORED_TILE_VALUE);
+        setBitboardTile (&pKnowledge->UnwalkablePlane, nXLocation, nYLocation, nSenseValue < UNEXPLORED_TILE_VALUE);
+
+        //The wolf and granny can have negative values, the rest of the elements are only positive
+        setBitboardTile (&pKnowledge->FlowerPlane, nXLocation, nYLocation, nSenseValue == FLOWER_TILE_VALUE);
+        setBitboardTile (&pKnowledge->WoodsmanPlane, nXLocation, nYLocation, nSenseValue == WOODSMAN_TILE_VALUE);
+        setBitboardTile (&pKnowledge->BakeryPlane, nXLocation, nYLocation, nSenseValue == BAKERY_TILE_VALUE);
+        setBitboardTile (&pKnowledge->GrandmaPlane, nXLocation, nYLocation, abs (nSenseValue) == GRANDMA_TILE_VALUE);
+        setBitboardTile (&pKnowledge->WolfPlane, nXLocation, nYLocation, abs (nSenseValue) == WOLF_TILE_VALUE);
+}
+
+/* This function updates whether or not the wolf's tile can be walked on. The wolf never moves,
+   so LRRH only needs to know if she has bread to pass him (positive value) or not (negative value).
+        
+        @param   (int)  nWolfXCoord is the X location of the wolf (-1 if the wolf has not been sensed yet)
+        @param   (int)  nWolfYCoord is the Y location of the wolf (-1 if the wolf has not been sensed yet)
+        @param   (int)  nHasBread tells whether or not LRRH has bread
+        @param   (int *)  pSensedTiles is the pointer to the narrSensedTiles Array 
+                (Contains information on which tiles LRRH has already sensed)
+        @param   (KnowledgeMap *)  pKnowledge is the pointer to Knowledge
+                (The bit planes that mirror the narrSensedTiles and narrWalkedTiles Arrays)
+        @param   (int)  nGridSize is the size of the playing grid
+        
+        @return  (void) no return value
+*/
+void 
+updateWolfTile (int nWolfXCoord, 
+                int nWolfYCoord, 
+                int nHasBread, 
+                int * pSensedTiles, 
+                KnowledgeMap * pKnowledge, 
+                int nGridSize)
+{
+        //Nothing to update if LRRH has not sensed the wolf yet
+        if (nWolfXCoord == -1 && nWolfYCoord == -1)
+                return;
+
+        if (nHasBread)
+                updateSensedTile (nWolfXCoord, nWolfYCoord, WOLF_TILE_VALUE, pSensedTiles, pKnowledge, nGridSize);
+        else
+                updateSensedTile (nWolfXCoord, nWolfYCoord, -WOLF_TILE_VALUE, pSensedTiles, pKnowledge, nGridSize);
+}
+
+/* This function remembers the woodsman's hint. Granny's house is exactly nWoodsmanDistance tiles away from the woodsman's house,
+   so it can only be on the diamond shaped ring of tiles at that distance. Each row of the grid has at most 2 tiles of the ring.
+        
+        @param   (int)  nWoodsmanXCoord is the X location of the woodsman's house
+        @param   (int)  nWoodsmanYCoord is the Y location of the woodsman's house
+        @param   (int)  nWoodsmanDistance is the distance between the woodsman's house and granny's house
+        @param   (KnowledgeMap *)  pKnowledge is the pointer to Knowledge
+                (The bit planes that mirror the narrSensedTiles and narrWalkedTiles Arrays)
+        
+        @return  (void) no return value
+*/
+void 
+updateGrannyRing (int nWoodsmanXCoord, int nWoodsmanYCoord, int nWoodsmanDistance, KnowledgeMap * pKnowledge)
+{
+        int nGridSize = pKnowledge->GrannyRingPlane.nGridSize;
+        int i;
+
+        pKnowledge->nWoodsmanDistance = nWoodsmanDistance;
+        clearBitboard (&pKnowledge->GrannyRingPlane, nGridSize);
+
+        for (i = 0; i < nGridSize; i++)
+        {
+                //The rest of the distance has to be covered inside the row
+                int nRowDistance = nWoodsmanDistance - abs (i - nWoodsmanXCoord);
+
+                if (nRowDistance < 0)
+                        continue;
+
+                if (isLocationValid (i, nWoodsmanYCoord - nRowDistance, nGridSize - 1))
+                        setBitboardTile (&pKnowledge->GrannyRingPlane, i, nWoodsmanYCoord - nRowDistance, 1);
+                if (isLocationValid (i, nWoodsmanYCoord + nRowDistance, nGridSize - 1))
+                        setBitboardTile (&pKnowledge->GrannyRingPlane, i, nWoodsmanYCoord + nRowDistance, 1);
+        }
+}
+
+/* This function checks whether or not LRRH can sense a tile of the granny ring that she has not sensed yet
+   when standing on a tile (One of its adjacent tiles is on the ring and has not been sensed)
+        
+        @param   (int)  nXLocation is the X location of the tile
+        @param   (int)  nYLocation is the Y location of the tile
+        @param   (KnowledgeMap *)  pKnowledge is the pointer to Knowledge
+                (The bit planes that mirror the narrSensedTiles and narrWalkedTiles Arrays)
+        
+        @return  (int) returns 1 if an unsensed tile of the ring can be sensed from the tile, 0 if not
+*/
+int 
+isNextToGrannyRing (int nXLocation, int nYLocation, KnowledgeMap * pKnowledge)
+{
+        int nGridSize = pKnowledge->GrannyRingPlane.nGridSize;
+        unsigned long long ullAdjacentTiles = 0;
+        int i;
+
+        //Get the tiles to the left and right of the tile in the same row, then check the rows above and below
+        for (i = nXLocation - 1; i <= nXLocation + 1; i++)
+        {
+                if (i < 0 || i >= nGridSize)
+                        continue;
+
+                if (i == nXLocation)
+                        ullAdjacentTiles = ((1ULL << nYLocation) << 1) | ((1ULL << nYLocation) >> 1);
+                else
+                        ullAdjacentTiles = 1ULL << nYLocation;
+
+                if (ullAdjacentTiles & pKnowledge->GrannyRingPlane.ullarrRows[i] & ~pKnowledge->SensedPlane.ullarrRows[i])
+                        return 1;
+        }
+
+        return 0;
+}
+
+/* This function moves the tiles in the X and Y queues where LRRH can sense the granny ring to the front of the queues.
+   The order of the tiles is otherwise kept, so the closest tiles next to the ring are explored first.
+   Nothing is moved if the woodsman has not given his hint yet or if granny has already been sensed.
+        
+        @param   (Queue *)  pXGridQueue is the pointer to XGridQueue
+                (The queue which stores the X coordinates of the locations to explore later on)
+        @param   (Queue *)  pYGridQueue is the pointer to YGridQueue 
+                (The queue which stores the Y coordinates of the locations to explore later on)
+        @param   (KnowledgeMap *)  pKnowledge is the pointer to Knowledge
+                (The bit planes that mirror the narrSensedTiles and narrWalkedTiles Arrays)
+        
+        @return  (void) no return value
+*/
+void 
+prioritizeGrannyRingCoordinates (Queue * pXGridQueue, Queue * pYGridQueue, KnowledgeMap * pKnowledge)
+{
+        if (pKnowledge->nWoodsmanDistance == -1 || countBitboardTiles (&pKnowledge->GrandmaPlane) > 0)
+                return;
+
+        int nNumOfCoordinates = pXGridQueue->nCount;
+        int narrXCoords[nNumOfCoordinates];
+        int narrYCoords[nNumOfCoordinates];
+        int nNumOfSorted = 0;
+        int nIsNextToRing;
+        int i;
+
+        //First copy the tiles next to the ring, then the rest of the tiles
+        for (nIsNextToRing = 1; nIsNextToRing >= 0; nIsNextToRing--)
+        {
+                for (i = 0; i < nNumOfCoordinates; i++)
+                {
+                        if (isNextToGrannyRing (pXGridQueue->pArray[i], pYGridQueue->pArray[i], pKnowledge) == nIsNextToRing){
+                                narrXCoords[nNumOfSorted] = pXGridQueue->pArray[i];
+                                narrYCoords[nNumOfSorted] = pYGridQueue->pArray[i];
+                                nNumOfSorted++;
+                        }
+                }
+        }
+
+        for (i = 0; i < nNumOfCoordinates; i++)
+        {
+                pXGridQueue->pArray[i] = narrXCoords[i];
+                pYGridQueue->pArray[i] = narrYCoords[i];
+        }
+}
+
+/* This function sorts the tiles in the X and Y queues by how much LRRH would learn for the distance she has to walk.
+   Each tile is scored by its number of unexplored neighbors (the tiles LRRH can sense from there) times FRONTIER_GAIN_WEIGHT,
+   minus its distance from LRRH. The tile with the highest score is put at the front of the queues.
+   If the scores are the same, the closer tile goes first, and if they are also the same, the previous order is kept.
+        
+        @param   (Queue *)  pXGridQueue is the pointer to XGridQueue
+                (The queue which stores the X coordinates of the locations to explore later on)
+        @param   (Queue *)  pYGridQueue is the pointer to YGridQueue 
+                (The queue which stores the Y coordinates of the locations to explore later on)
+        @param   (int)  nLRRHXLocation is the X location of LRRH
+        @param   (int)  nLRRHYLocation is the Y location of LRRH
+        @param   (KnowledgeMap *)  pKnowledge is the pointer to Knowledge
+                (The bit planes that mirror the narrSensedTiles and narrWalkedTiles Arrays)
+        
+        @return  (void) no return value
+*/
+void 
+sortCoordinatesByInformationGain (Queue * pXGridQueue, 
+                                Queue * pYGridQueue, 
+                                int nLRRHXLocation, 
+                                int nLRRHYLocation, 
+                                KnowledgeMap * pKnowledge)
+{
+        int nGridSize = pKnowledge->SensedPlane.nGridSize;
+        int nNumOfCoordinates = pXGridQueue->nCount;
+        int narrScores[nNumOfCoordinates];
+        int narrDistances[nNumOfCoordinates];
+        int i, j;
+
+        for (i = 0; i < nNumOfCoordinates; i++)
+        {
+                int nXCoord = pXGridQueue->pArray[i];
+                int nYCoord = pYGridQueue->pArray[i];
+
+                narrDistances[i] = getDistance (nLRRHXLocation, nLRRHYLocation, nXCoord, nYCoord);
+                narrScores[i] = pKnowledge->narrUnexploredNeighbors[nXCoord * nGridSize + nYCoord] * FRONTIER_GAIN_WEIGHT - 
+                                narrDistances[i];
+        }
+
+        //Perform an insertion sort, which keeps the order of the tiles with the same score and distance
+        for (i = 1; i < nNumOfCoordinates; i++)
+        {
+                int nXCoord = pXGridQueue->pArray[i];
+                int nYCoord = pYGridQueue->pArray[i];
+                int nScore = narrScores[i];
+                int nDistance = narrDistances[i];
+
+                for (j = i - 1; j >= 0 && (narrScores[j] < nScore || (narrScores[j] == nScore && narrDistances[j] > nDistance)); j--)
+                {
+                        pXGridQueue->pArray[j + 1] = pXGridQueue->pArray[j];
+                        pYGridQueue->pArray[j + 1] = pYGridQueue->pArray[j];
+                        narrScores[j + 1] = narrScores[j];
+                        narrDistances[j + 1] = narrDistances[j];
+                }
+
+                pXGridQueue->pArray[j + 1] = nXCoord;
+                pYGridQueue->pArray[j + 1] = nYCoord;
+                narrScores[j + 1] = nScore;
+                narrDistances[j + 1] = nDistance;
+        }
+}
+
+/* This function removes the tiles in the X and Y queues that have no unexplored neighbors left, 
+   since LRRH would not learn anything new by going there. The order of the other tiles is kept.
+   Unlike removeWalkedCoordinatesFromQueue, a tile LRRH walked on is kept if she deferred sensing its neighbors.
+        
+        @param   (Queue *)  pXGridQueue is the pointer to XGridQueue
+                (The queue which stores the X coordinates of the locations to explore later on)
+        @param   (Queue *)  pYGridQueue is the pointer to YGridQueue 
+                (The queue which stores the Y coordinates of the locations to explore later on)
+        @param   (KnowledgeMap *)  pKnowledge is the pointer to Knowledge
+                (The bit planes that mirror the narrSensedTiles and narrWalkedTiles Arrays)
+        
+        @return  (void) no return value
+*/
+void 
+removeExploredCoordinatesFromQueue (Queue * pXGridQueue, Queue * pYGridQueue, KnowledgeMap * pKnowledge)
+{
+        int nGridSize = pKnowledge->SensedPlane.nGridSize;
+        int nNumOfKeptTiles = 0;
+        int i;
+
+        for (i = 0; i < pXGridQueue->nCount; i++)
+        {
+                int nXCoord = pXGridQueue->pArray[i];
+                int nYCoord = pYGridQueue->pArray[i];
+
+                if (pKnowledge->narrUnexploredNeighbors[nXCoord * nGridSize + nYCoord] > 0){
+                        pXGridQueue->pArray[nNumOfKeptTiles] = nXCoord;
+                        pYGridQueue->pArray[nNumOfKeptTiles] = nYCoord;
+                        nNumOfKeptTiles++;
+                }
+        }
+
+        if (nNumOfKeptTiles != pXGridQueue->nCount){
+                pXGridQueue->nCount = nNumOfKeptTiles;
+                pYGridQueue->nCount = nNumOfKeptTiles;
+
+                pXGridQueue->pArray = realloc (pXGridQueue->pArray, nNumOfKeptTiles * sizeof(int));
+                pYGridQueue->pArray = realloc (pYGridQueue->pArray, nNumOfKeptTiles * sizeof(int));
+        }
+}
+
+/* This function initializes the planning budget of the A* path generation
+        @param   (PlanningBudget *)  pBudget is the pointer to Budget
+        @param   (int)  nExpansionBudget is the number of states the path generation can check in a turn (0 if there is no limit)
+        
+        @return  (void) no return value
+*/
+void
+initPlanningBudget (PlanningBudget * pBudget, int nExpansionBudget)
+{
+        pBudget->nExpansionBudget = nExpansionBudget;
+        pBudget->nCurrentBudget = nExpansionBudget;
+
+        //No search has been started yet
+        pBudget->nDestinationXCoord = -1;
+        pBudget->nDestinationYCoord = -1;
+}
+
+/* This function marks a tile in the narrWalkedTiles Array as walked and updates the walked plane to match it.
+        
+        @param   (int)  nXLocation is the X location of the tile
+        @param   (int)  nYLocation is the Y location of the tile
+
+        @param   (int *)  pWalkedTiles is the pointer to the narrWalkedTiles Array 
+                (Contains information on which tiles LRRH has already walked on)
+        @param   (KnowledgeMap *)  pKnowledge is the pointer to Knowledge
+                (The bit planes that mirror the narrSensedTiles and narrWalkedTiles Arrays)
+
+        @param   (int)  nGridSize is the size of the playing grid
+        
+        @return  (void) no return value
+*/
+void
+updateWalkedTile (int nXLocation, int nYLocation, int * pWalkedTiles, KnowledgeMap * pKnowledge, int nGridSize)
+{
+        *(pWalkedTiles + nXLocation * nGridSize + nYLocation) = 1;
+
+        setBitboardTile (&pKnowledge->WalkedPlane, nXLocation, nYLocation, 1);
+}
+
+/* This function starts the state of a game, with LRRH at (1,1) facing south with no items, and every queue empty.
+   The playing grid and what LRRH knows about it are kept by the caller.
+        @param   (GameState *)  pGame is the pointer to Game
+        @param   (char *)  pPlayGrid is the pointer to carrPlayGrid
+        @param   (int *)  pSensedTiles is the pointer to the narrSensedTiles Array 
+                (Contains information on which tiles LRRH has already sensed)
+        @param   (int *)  pWalkedTiles is the pointer to the narrWalkedTiles Array 
+                (Contains information on which tiles LRRH has already walked on)
+        @param   (KnowledgeMap *)  pKnowledge is the pointer to Knowledge
+                (The bit planes that mirror the narrSensedTiles and narrWalkedTiles Arrays)
+        @param   (int)  nGridSize is the size of the playing grid
+        @param   (int)  nSensingMode tells whether LRRH senses every adjacent tile or defers some of them while walking
+        @param   (int)  nStepByStepMode tells whether or not to wait for user input until the next turn
+        @param   (int)  nHasSounds tells whether or not the application should play sound for each turn 
+        
+        @return  (void) no return value
+*/
+void
+initGameState (GameState * pGame,
+                char * pPlayGrid,
+                int * pSensedTiles,
+                int * pWalkedTiles,
+                KnowledgeMap * pKnowledge,
+                int nGridSize,
+                int nSensingMode,
+                int nStepByStepMode,
+                int nHasSounds)
+{
+        pGame->nLRRHXLocation = 0;
+        pGame->nLRRHYLocation = 0;
+        pGame->cLRRHViewDirection = DIRECTION_SOUTH;
+        pGame->cPreviousWalkedTileValue = EMPTY_TILE;
+
+        pGame->nNumOfSenses = 0;
+        pGame->nNumOfRotations = 0;
+        pGame->nNumOfMovements = 0;
+        pGame->nNumOfTurns = 0;
+
+        pGame->nHasFlower = 0;
+        pGame->nHasBread = 0;
+        pGame->nVisitedWoodsman = 0;
+        pGame->nWasBreadTaken = 0;
+
+        pGame->nHasSensedBread = 0;
+        pGame->nHasSensedFlower = 0;
+        pGame->nHasSensedWoodsman = 0;
+        pGame->nHasSensedGrandma = 0;
+        pGame->nIsGrannyApproachable = 0;
+        pGame->nWolfXCoord = -1;
+        pGame->nWolfYCoord = -1;
+
+        pGame->pPlayGrid = pPlayGrid;
+        pGame->pSensedTiles = pSensedTiles;
+        pGame->pWalkedTiles = pWalkedTiles;
+        pGame->pKnowledge = pKnowledge;
+        pGame->nGridSize = nGridSize;
+
+        initQueue (&pGame->XGridQueue);
+        initQueue (&pGame->YGridQueue);
+        initQueue (&pGame->ActionQueue);
+
+        pGame->nSensingMode = nSensingMode;
+        pGame->nStepByStepMode = nStepByStepMode;
+        pGame->nHasSounds = nHasSounds;
+}
+
+/* This function frees the memory used by the queues of a game
+        @param   (GameState *)  pGame is the pointer to Game
+        
+        @return  (void) no return value
+*/
+void
+clearGameState (GameState * pGame)
+{
+        clearQueue (&pGame->XGridQueue);
+        clearQueue (&pGame->YGridQueue);
+        clearQueue (&pGame->ActionQueue);
+}
+
+/* This function initializes a snapshot of a game. It holds nothing until saveGameSnapshot is called.
+        @param   (GameSnapshot *)  pSnapshot is the pointer to the snapshot
+        
+        @return  (void) no return value
+*/
+void
+initGameSnapshot (GameSnapshot * pSnapshot)
+{
+        pSnapshot->pQueueElements = NULL;
+        pSnapshot->nQueueCapacity = 0;
+}
+
+/* This function frees the memory used by a snapshot of a game
+        @param   (GameSnapshot *)  pSnapshot is the pointer to the snapshot
+        
+        @return  (void) no return value
+*/
+void
+clearGameSnapshot (GameSnapshot * pSnapshot)
+{
+        free (pSnapshot->pQueueElements);
+        pSnapshot->pQueueElements = NULL;
+        pSnapshot->nQueueCapacity = 0;
+}
+
+/* This function copies everything a game depends on into a snapshot: LRRH, her counters and items, what she has spotted,
+   the playing grid, the sensed and walked tiles, the knowledge bit planes, the queues, and the random numbers.
+        @param   (GameSnapshot *)  pSnapshot is the pointer to the snapshot
+        @param   (GameState *)  pGame is the pointer to the game to copy
+        
+        @return  (void) no return value
+*/
+void
+saveGameSnapshot (GameSnapshot * pSnapshot, GameState * pGame)
+{
+        int nNumOfTiles = pGame->nGridSize * pGame->nGridSize;
+        int nNumOfXGridElements = pGame->XGridQueue.nCount;
+        int nNumOfYGridElements = pGame->YGridQueue.nCount;
+        int nNumOfActionElements = pGame->ActionQueue.nCount;
+        int nNumOfQueueElements = nNumOfXGridElements + nNumOfYGridElements + nNumOfActionElements;
+
+        pSnapshot->State = *pGame;
+
+        memcpy (pSnapshot->carrPlayGrid, pGame->pPlayGrid, nNumOfTiles * sizeof(char));
+        memcpy (pSnapshot->narrSensedTiles, pGame->pSensedTiles, nNumOfTiles * sizeof(int));
+        memcpy (pSnapshot->narrWalkedTiles, pGame->pWalkedTiles, nNumOfTiles * sizeof(int));
+        pSnapshot->Knowledge = *pGame->pKnowledge;
+
+        if (nNumOfQueueElements > pSnapshot->nQueueCapacity){
+                pSnapshot->pQueueElements = realloc (pSnapshot->pQueueElements, nNumOfQueueElements * sizeof(int));
+                pSnapshot->nQueueCapacity = nNumOfQueueElements;
+        }
+
+        memcpy (pSnapshot->pQueueElements, 
+                pGame->XGridQueue.pArray, 
+                nNumOfXGridElements * sizeof(int));
+        memcpy (pSnapshot->pQueueElements + nNumOfXGridElements, 
+                pGame->YGridQueue.pArray, 
+                nNumOfYGridElements * sizeof(int));
+        memcpy (pSnapshot->pQueueElements + nNumOfXGridElements + nNumOfYGridElements, 
+                pGame->ActionQueue.pArray, 
+                nNumOfActionElements * sizeof(int));
+}
+
+/* This function puts a game back to the point a snapshot was taken. The game keeps its own playing grid, tiles arrays,
+   knowledge bit planes, and queues, and only their contents are replaced, so it has to be the same size as the snapshot.
+        @param   (GameSnapshot *)  pSnapshot is the pointer to the snapshot
+        @param   (GameState *)  pGame is the pointer to the game to restore
+        
+        @return  (void) no return value
+*/
+void
+restoreGameSnapshot (GameSnapshot * pSnapshot, GameState * pGame)
+{
+        //Remember the buffers of the game before every value is copied over
+        char * pPlayGrid = pGame->pPlayGrid;
+        int * pSensedTiles = pGame->pSensedTiles;
+        int * pWalkedTiles = pGame->pWalkedTiles;
+        KnowledgeMap * pKnowledge = pGame->pKnowledge;
+        Queue XGridQueue = pGame->XGridQueue;
+        Queue YGridQueue = pGame->YGridQueue;
+        Queue ActionQueue = pGame->ActionQueue;
+
+        GameState * pSavedGame = &pSnapshot->State;
+        int nNumOfTiles = pSavedGame->nGridSize * pSavedGame->nGridSize;
+        int nNumOfXGridElements = pSavedGame->XGridQueue.nCount;
+        int nNumOfYGridElements = pSavedGame->YGridQueue.nCount;
+
+        *pGame = *pSavedGame;
+
+        pGame->pPlayGrid = pPlayGrid;
+        pGame->pSensedTiles = pSensedTiles;
+        pGame->pWalkedTiles = pWalkedTiles;
+        pGame->pKnowledge = pKnowledge;
+
+        memcpy (pPlayGrid, pSnapshot->carrPlayGrid, nNumOfTiles * sizeof(char));
+        memcpy (pSensedTiles, pSnapshot->narrSensedTiles, nNumOfTiles * sizeof(int));
+        memcpy (pWalkedTiles, pSnapshot->narrWalkedTiles, nNumOfTiles * sizeof(int));
+        *pKnowledge = pSnapshot->Knowledge;
+
+        setQueueElements (&XGridQueue, 
+                                pSnapshot->pQueueElements, 
+                                nNumOfXGridElements);
+        setQueueElements (&YGridQueue, 
+                                pSnapshot->pQueueElements + nNumOfXGridElements, 
+                                nNumOfYGridElements);
+        setQueueElements (&ActionQueue, 
+                                pSnapshot->pQueueElements + nNumOfXGridElements + nNumOfYGridElements, 
+                                pSavedGame->ActionQueue.nCount);
+
+        pGame->XGridQueue = XGridQueue;
+        pGame->YGridQueue = YGridQueue;
+        pGame->ActionQueue = ActionQueue;
+}
@@ -3,17 +3,170 @@
 *
 * Description:
 * 	LRRHFunctions_prototype.h: Contains the function prototypes of LRRHFunctions.c
-* Last Modified: 28/01/2022
+* Last Modified: 19/10/2026
 */
 
 #include <limits.h>
+#include <string.h>
+
+//Bit planes that mirror what LRRH knows about the playing grid. Each plane is kept in sync with narrSensedTiles and narrWalkedTiles.
+typedef struct
+{
+  Bitboard SensedPlane;
+  Bitboard WalkablePlane;
+  Bitboard UnwalkablePlane;
+  Bitboard WalkedPlane;
+  Bitboard FlowerPlane;
+  Bitboard WoodsmanPlane;
+  Bitboard BakeryPlane;
+  Bitboard GrandmaPlane;
+  Bitboard WolfPlane;
+
+  //The tiles granny's house can be on, given by the woodsman's hint (nWoodsmanDistance is -1 until then)
+  Bitboard GrannyRingPlane;
+  int nWoodsmanDistance;
+
+  //The number of unexplored neighbors of every tile (index X * nGridSize + Y), kept in sync by updateSensedTile
+  int narrUnexploredNeighbors[BITBOARD_MAX_GRID_SIZE * BITBOARD_MAX_GRID_SIZE];
+
+} KnowledgeMap;
+
+typedef struct
+{
+  //The number of states the A* path generation can check in a single turn (0 if there is no limit)
+  int nExpansionBudget;
+
+  //The budget of the current search. It is doubled each time the search toward the same destination runs out,
+  //so that a path to the destination is always found in the end.
+  int nCurrentBudget;
+  int nDestinationXCoord;
+  int nDestinationYCoord;
+
+} PlanningBudget;
+
+typedef struct
+{
+  //Where the game keeps the state that the next path will be planned from
+  int * pLRRHXLocation;
+  int * pLRRHYLocation;
+  char * pLRRHViewDirection;
+  Queue * pXGridQueue;
+  Queue * pYGridQueue;
+  int * pSensedTiles;
+  int * pWalkedTiles;
+  KnowledgeMap * pKnowledge;
+  PlanningBudget * pBudget;
+  int nGridSize;
+  int nFrontierMode;
+  int nSensingMode;
+
+  //Tells whether or not the queue still has to be sorted before its front tile is the next one LRRH goes to
+  int nShouldOrderQueue;
+
+  //Copy of the state when the pause started, used to check if the plan is still correct later on
+  int nHasPlan;
+  int nStartXCoord;
+  int nStartYCoord;
+  char cStartDirection;
+  int nDestinationXCoord;
+  int nDestinationYCoord;
+  int narrSensedTiles[BITBOARD_MAX_GRID_SIZE * BITBOARD_MAX_GRID_SIZE];
+  KnowledgeMap Knowledge;
+  PlanningBudget Budget;
+
+  //The plan made by the worker thread, including the changes the path generation made to its own copy of the state
+  int narrPlannedSensedTiles[BITBOARD_MAX_GRID_SIZE * BITBOARD_MAX_GRID_SIZE];
+  KnowledgeMap PlannedKnowledge;
+  PlanningBudget PlannedBudget;
+  Queue ActionQueue;
+  char carrPathGrid[BITBOARD_MAX_GRID_SIZE * BITBOARD_MAX_GRID_SIZE];
+  int nPathEndState;
+  int nIsDestinationValid;
+
+  //The worker thread making the plan (NULL if there is none running)
+  HANDLE hWorkerThread;
+
+} SpeculativePlan;
+
+//Everything one game changes while it is played, passed around by a single pointer instead of one pointer for each value
+typedef struct
+{
+  //LRRH's location, her viewing direction, and the value of the tile she is standing on (used by every action)
+  int nLRRHXLocation;
+  int nLRRHYLocation;
+  char cLRRHViewDirection;
+  char cPreviousWalkedTileValue;
+
+  int nNumOfSenses;
+  int nNumOfRotations;
+  int nNumOfMovements;
+  int nNumOfTurns;
+
+  //Items of LRRH, and whether or not the wolf took her bread on the tile she is standing on
+  int nHasFlower;
+  int nHasBread;
+  int nVisitedWoodsman;
+  int nWasBreadTaken;
+
+  //What LRRH has spotted so far, and where the wolf is (-1 until he is spotted)
+  int nHasSensedBread;
+  int nHasSensedFlower;
+  int nHasSensedWoodsman;
+  int nHasSensedGrandma;
+  int nIsGrannyApproachable;
+  int nWolfXCoord;
+  int nWolfYCoord;
+
+  //The playing grid, and what LRRH knows about it
+  char * pPlayGrid;
+  int * pSensedTiles;
+  int * pWalkedTiles;
+  KnowledgeMap * pKnowledge;
+  int nGridSize;
+
+  //The tiles to explore later on, and the actions of the path LRRH is walking
+  Queue XGridQueue;
+  Queue YGridQueue;
+  Queue ActionQueue;
+
+  //Random numbers of the game (only used by random mode, seeded by the caller)
+  RandomGenerator Generator;
+
+  //Settings of the game
+  int nSensingMode;
+  int nStepByStepMode;
+  int nHasSounds;
+
+} GameState;
+
+//A copy of everything a game depends on, so that the game can be put back to this point later on
+typedef struct
+{
+  //Every value of the game state. The pointers in it are not used, the game restored into keeps its own buffers.
+  GameState State;
+
+  //Flat copies of what the game state points to (only the first nGridSize * nGridSize tiles are used)
+  char carrPlayGrid[BITBOARD_MAX_GRID_SIZE * BITBOARD_MAX_GRID_SIZE];
+  int narrSensedTiles[BITBOARD_MAX_GRID_SIZE * BITBOARD_MAX_GRID_SIZE];
+  int narrWalkedTiles[BITBOARD_MAX_GRID_SIZE * BITBOARD_MAX_GRID_SIZE];
+  KnowledgeMap Knowledge;
+
+  //The X grid, Y grid, and action queues one after the other. It only grows, so taking snapshots again does not allocate.
+  int * pQueueElements;
+  int nQueueCapacity;
+
+} GameSnapshot;
 
 int     convertDirectionSymbolToXMovement       (char cCurrentDirection);
 int     convertDirectionSymbolToYMovement       (char cCurrentDirection);
 char    getOppositeDirection                    (char cDirection);
 char    directionVectorToSymbol                 (int xMovement, 
                                                 int yMovement);
-int     computeWoodsmanDistance                 (char * pPlayGrid, 
+int     convertDirectionSymbolToIndex           (char cDirection);
+char    convertIndexToDirectionSymbol           (int nIndex);
+int     computeWoodsmanDistance                 (int nWoodsmanXCoord, 
+                                                int nWoodsmanYCoord, 
+                                                char * pPlayGrid, 
                                                 int nGridSize);
 char    forwardLRRH                             (int * pNumOfMovements, 
                                                 int * pLRRHXLocation, 
@@ -35,6 +188,8 @@ void    smartRotateLRRH                         (int * pNumOfSenses,
                                                 int nGridSize, 
                                                 int nStepByStepMode, 
                                                 int nHasSounds);
+int     countLRRHRotations                      (char cCurrentDirection, 
+                                                char cNewDirection);
 void    rotateRightLRRH                         (int * pNumOfRotations, 
                                                 char * pCurrentDirection, 
                                                 char * pLRRHTile);
@@ -47,137 +202,190 @@ char    senseLRRH                               (int * pNumOfSenses,
                                                 char * pLRRHTile, 
                                                 char * pCurrentDirection, 
                                                 int nGridSize);
-void    senseAndQueueLRRHAdjacentTiles          (int * pLRRHXLocation, 
-                                                int * pLRRHYLocation,
-                                                int * pWolfXCoord, 
-                                                int * pWolfYCoord,
-                                                int * pSensedTiles, 
-                                                char * pPlayGrid, 
-                                                char * pLRRHViewDirection, 
-                                                int nGridSize,
-                                                int * pNumOfSenses, 
-                                                int * pNumOfRotations, 
-                                                int * pNumOfMovements, 
-                                                int * pNumOfTurns,
-                                                int * pIsGrannyApproachable, 
-                                                int * pHasBread, 
-                                                int * pHasSensedBread,  
-                                                int * pHasSensedFlower, 
-                                                int * pHasSensedWoodsman, 
-                                                int * pHasSensedGrandma,
-                                                Queue * pXGridQueue, 
-                                                Queue * pYGridQueue, 
-                                                int nStepByStepMode, 
-                                                int nHasSounds);
-void    senseAndQueueLRRHForwardTile            (int * pLRRHXLocation, 
-                                                int * pLRRHYLocation,
-                                                int * pWolfXCoord, 
-                                                int * pWolfYCoord,
-                                                int * pSensedTiles, 
-                                                char * pPlayGrid, 
-                                                char * pLRRHViewDirection, 
-                                                int nGridSize,
-                                                int * pNumOfSenses, 
-                                                int * pNumOfRotations, 
-                                                int * pNumOfMovements, 
-                                                int * pNumOfTurns,
-                                                int * pIsGrannyApproachable, 
-                                                int * pHasBread, 
-                                                int * pHasSensedBread, 
-                                                int * pHasSensedFlower, 
-                                                int * pHasSensedWoodsman, 
-                                                int * pHasSensedGrandma,
-                                                Queue * pXGridQueue, 
-                                                Queue * pYGridQueue, 
-                                                int nStepByStepMode, 
-                                                int nHasSounds, 
+void    senseAndQueueLRRHAdjacentTiles          (GameState * pGame,
+                                                char cNextMoveDirection);
+void    scheduleLRRHSenses                      (char cLRRHViewDirection, 
+                                                char cNextMoveDirection, 
+                                                char * pSenseDirections, 
+                                                int nNumOfSenseDirections);
+void    senseAndQueueLRRHForwardTile            (GameState * pGame,
                                                 char cDirectionSymbol);
 void    generateAStarPath                       (int nLRRHXLocation, 
                                                 int nLRRHYLocation,
+                                                char cLRRHViewDirection,
                                                 int nNewLRRHXLocation, 
                                                 int nNewLRRHYLocation,
                                                 int * pSensedTiles, 
+                                                KnowledgeMap * pKnowledge,
+                                                char * pPlayGrid,
+                                                int nGridSize, 
+                                                Queue * pActionQueue, 
+                                                int * pIsDestinationValid,
+                                                PlanningBudget * pBudget);
+void    searchAStarPath                         (int nLRRHXLocation, 
+                                                int nLRRHYLocation,
+                                                char cLRRHViewDirection,
+                                                int nNewLRRHXLocation, 
+                                                int nNewLRRHYLocation,
+                                                int * pSensedTiles, 
+                                                KnowledgeMap * pKnowledge,
+                                                int nGridSize, 
+                                                Queue * pActionQueue, 
+                                                int * pIsDestinationValid,
+                                                PlanningBudget * pBudget,
+                                                char * pPathGrid,
+                                                int * pPathEndState);
+void    displayAStarPath                        (int nLRRHXLocation, 
+                                                int nLRRHYLocation,
+                                                int nNewLRRHXLocation, 
+                                                int nNewLRRHYLocation,
+                                                int nPathEndState,
+                                                char * pPlayGrid,
+                                                char * pPathGrid,
+                                                int nGridSize, 
+                                                Queue * pActionQueue);
+void    generateBFSPathToClosestTile            (int nLRRHXLocation, 
+                                                int nLRRHYLocation,
+                                                int * pNewLRRHXLocation, 
+                                                int * pNewLRRHYLocation,
+                                                Queue * pXGridQueue, 
+                                                Queue * pYGridQueue,
+                                                int * pSensedTiles, 
+                                                KnowledgeMap * pKnowledge,
                                                 char * pPlayGrid,
                                                 int nGridSize, 
                                                 Queue * pActionQueue, 
                                                 int * pIsDestinationValid);
 void    generatePathToClosestBakery             (int nLRRHXLocation, 
                                                 int nLRRHYLocation, 
+                                                char cLRRHViewDirection,
                                                 int * nBakeryXCoord, 
                                                 int * nBakeryYCoord,
                                                 int * pHasSensedBread, 
                                                 int * pSensedTiles, 
+                                                KnowledgeMap * pKnowledge,
                                                 char * pPlayGrid,
                                                 int nGridSize, 
                                                 Queue * pActionQueue, 
-                                                int * pIsDestinationValid);
-void    moveLRRHToPath                          (int * pLRRHXLocation, 
-                                                int * pLRRHYLocation,
+                                                int * pIsDestinationValid,
+                                                PlanningBudget * pBudget);
+int     chooseNextObjective                     (int nLRRHXLocation, 
+                                                int nLRRHYLocation, 
+                                                KnowledgeMap * pKnowledge,
+                                                int nHasFlower, 
+                                                int nVisitedWoodsman, 
+                                                int nHasBread, 
+                                                int nCanGetBread,
+                                                int * pObjectiveXCoord, 
+                                                int * pObjectiveYCoord);
+void    moveLRRHToPath                          (GameState * pGame,
                                                 int nNewLRRHXLocation, 
-                                                int nNewLRRHYLocation,
-                                                int * pWolfXCoord, 
-                                                int * pWolfYCoord,
-                                                Queue * pActionQueue, 
-                                                int * pNumOfSenses, 
-                                                int * pNumOfRotations, 
-                                                int * pNumOfMovements, 
-                                                int * pNumOfTurns, 
-                                                int nGridSize, 
-                                                char * pPlayGrid, 
-                                                int * pWalkedTiles, 
-                                                int * pSensedTiles,
-                                                int * pHasFlower, 
-                                                int * pHasBread, 
-                                                int * pVisitedWoodsman, 
-                                                int * pWasBreadTaken,
-                                                char * pLRRHViewDirection, 
-                                                char * pMovementScenario, 
-                                                int nStepByStepMode, 
-                                                int nHasSounds);
-void    moveLRRHToPathWhileSensing              (int * pLRRHXLocation, 
-                                                int * pLRRHYLocation,
+                                                int nNewLRRHYLocation);
+void    moveLRRHToPathWhileSensing              (GameState * pGame,
                                                 int nNewLRRHXLocation, 
-                                                int nNewLRRHYLocation,
-                                                int * pWolfXCoord, 
-                                                int * pWolfYCoord,
-                                                Queue * pActionQueue, 
-                                                Queue * pXGridQueue, 
-                                                Queue * pYGridQueue,
-                                                int * pNumOfSenses, 
-                                                int * pNumOfRotations, 
-                                                int * pNumOfMovements, 
-                                                int * pNumOfTurns, 
-                                                int nGridSize, 
-                                                char * pPlayGrid, 
-                                                int * pWalkedTiles, 
-                                                int * pSensedTiles,
-                                                int * pHasFlower, 
-                                                int * pHasBread, 
-                                                int * pVisitedWoodsman,
-                                                int * pWasBreadTaken,
-                                                int * pHasSensedBread, 
-                                                int * pHasSensedFlower, 
-                                                int * pHasSensedWoodsman, 
-                                                int * pHasSensedGrandma, 
-                                                int * pIsGrannyApproachable,
-                                                char * pLRRHViewDirection, 
-                                                char * pMovementScenario, 
-                                                int nStepByStepMode, 
-                                                int nHasSounds);
+                                                int nNewLRRHYLocation);
 void    waitForNextTurn                         (int * pNumOfTurns, 
                                                 int nStepByStepMode, 
                                                 int nHasSounds);
-int     sensedEveryTile                         (int * pSensedTiles,
-                                                int nGridSize);
+int     sensedEveryTile                         (KnowledgeMap * pKnowledge);
 void    recallSensedTile                        (int nSenseValue, 
                                                 int * pXCoord, 
                                                 int * pYCoord, 
-                                                int * pSensedTiles, 
-                                                int nGridSize);
+                                                KnowledgeMap * pKnowledge);
 int     isWolfTileSkippable                     (int nLRRHXLocation, 
                                                 int nLRRHYLocation, 
                                                 int nXGridLocation, 
                                                 int nYGridLocation, 
+                                                KnowledgeMap * pKnowledge,
+                                                int nQueueCapacity);
+void    initKnowledgeMap                        (KnowledgeMap * pKnowledge, 
+                                                int nGridSize);
+Bitboard * getKnowledgePlane                    (KnowledgeMap * pKnowledge, 
+                                                int nSenseValue);
+void    updateSensedTile                        (int nXLocation, 
+                                                int nYLocation, 
+                                                int nSenseValue, 
+                                                int * pSensedTiles, 
+                                                KnowledgeMap * pKnowledge, 
+                                                int nGridSize);
+void    updateWolfTile                          (int nWolfXCoord, 
+                                                int nWolfYCoord, 
+                                                int nHasBread, 
+                                                int * pSensedTiles, 
+                                                KnowledgeMap * pKnowledge, 
+                                                int nGridSize);
+void    updateGrannyRing                        (int nWoodsmanXCoord, 
+                                                int nWoodsmanYCoord, 
+                                                int nWoodsmanDistance, 
+                                                KnowledgeMap * pKnowledge);
+int     isNextToGrannyRing                      (int nXLocation, 
+                                                int nYLocation, 
+                                                KnowledgeMap * pKnowledge);
+void    prioritizeGrannyRingCoordinates         (Queue * pXGridQueue, 
+                                                Queue * pYGridQueue, 
+                                                KnowledgeMap * pKnowledge);
+void    sortCoordinatesByInformationGain        (Queue * pXGridQueue, 
+                                                Queue * pYGridQueue, 
+                                                int nLRRHXLocation, 
+                                                int nLRRHYLocation, 
+                                                KnowledgeMap * pKnowledge);
+void    removeExploredCoordinatesFromQueue      (Queue * pXGridQueue, 
+                                                Queue * pYGridQueue, 
+                                                KnowledgeMap * pKnowledge);
+void    initPlanningBudget                      (PlanningBudget * pBudget, 
+                                                int nExpansionBudget);
+void    orderFrontierQueue                      (Queue * pXGridQueue, 
+                                                Queue * pYGridQueue, 
+                                                int nLRRHXLocation, 
+                                                int nLRRHYLocation, 
+                                                int * pWalkedTiles, 
+                                                KnowledgeMap * pKnowledge, 
+                                                int nGridSize, 
+                                                int nFrontierMode, 
+                                                int nSensingMode);
+void    initSpeculativePlan                     (SpeculativePlan * pPlan,
+                                                int * pLRRHXLocation,
+                                                int * pLRRHYLocation,
+                                                char * pLRRHViewDirection,
+                                                Queue * pXGridQueue, 
+                                                Queue * pYGridQueue,
                                                 int * pSensedTiles, 
+                                                int * pWalkedTiles,
+                                                KnowledgeMap * pKnowledge,
+                                                PlanningBudget * pBudget,
                                                 int nGridSize,
-                                                int nQueueCapacity);
\ No newline at end of file
+                                                int nFrontierMode,
+                                                int nSensingMode);
+void    clearSpeculativePlan                    (SpeculativePlan * pPlan);
+void    setPendingSpeculativePlan               (SpeculativePlan * pPlan,
+                                                int nShouldOrderQueue);
+void    startSpeculativePlan                    ();
+DWORD WINAPI runSpeculativePlan                 (LPVOID pParameter);
+void    finishSpeculativePlan                   ();
+int     adoptSpeculativePlan                    (SpeculativePlan * pPlan,
+                                                int nNewLRRHXLocation, 
+                                                int nNewLRRHYLocation,
+                                                char * pPlayGrid,
+                                                Queue * pActionQueue, 
+                                                int * pIsDestinationValid);
+void    updateWalkedTile                        (int nXLocation, 
+                                                int nYLocation, 
+                                                int * pWalkedTiles, 
+                                                KnowledgeMap * pKnowledge, 
+                                                int nGridSize);
+void    initGameState                           (GameState * pGame,
+                                                char * pPlayGrid,
+                                                int * pSensedTiles,
+                                                int * pWalkedTiles,
+                                                KnowledgeMap * pKnowledge,
+                                                int nGridSize,
+                                                int nSensingMode,
+                                                int nStepByStepMode,
+                                                int nHasSounds);
+void    clearGameState                          (GameState * pGame);
+void    initGameSnapshot                        (GameSnapshot * pSnapshot);
+void    clearGameSnapshot                       (GameSnapshot * pSnapshot);
+void    saveGameSnapshot                        (GameSnapshot * pSnapshot,
+                                                GameState * pGame);
+void    restoreGameSnapshot                     (GameSnapshot * pSnapshot,
+                                                GameState * pGame);
@@ -4,7 +4,7 @@
 * Description:
 * 	LRRHGame.c: This file contains the LRRH Game and the logic used to run the game. 
 *
-* Last Modified: 07/02/2022
+* Last Modified: 19/10/2026
 * Acknowledgements: 
 *       Pointers and 2D arrays - https://overiq.com/c-programming-101/pointers-and-2-d-arrays/
 *       Examples of Pathfinding Algorithms - http://theory.stanford.edu/~amitp/GameProgramming/AStarComparison.html
@@ -14,6 +14,11 @@
 *       The Story of Little Red Riding Hood - https://americanliterature.com/author/the-brothers-grimm/fairy-tale/little-red-cap
 */
 #include "LRRHFunctions.c"
+#include "AnalysisSystem.c"
+#include "SimulationSystem.c"
+#include "GameSystem.c"
+#include "RolloutSystem.c"
+#include "StrategySystem.c"
 #include "LRRHGame_prototype.h"
 
 #define MAX_INPUT_LENGTH 100
@@ -236,30 +241,19 @@ initializeObjects (char * pPlayGrid, int nGridSize, int nJumboMode, int nHasSoun
         @param   (int)  nStepByStepMode tells whether or not LRRH will move automatically
         @param   (int)  nHasSounds tells whether or not to play sound
         @param   (int)  nSmartMode tells whether or not LRRH will move intelligently or randomly
+        @param   (int)  nFrontierMode tells how LRRH will pick the next tile to explore in smart mode
+        @param   (int)  nSensingMode tells whether LRRH senses every adjacent tile or defers some of them while walking in smart mode
+        @param   (int)  nPlanningBudget is the number of states the path generation can check in a turn in smart mode (0 if there is no limit)
+        @param   (int)  nTurnLimit is the number of turns LRRH can take in random mode before the game is stopped (0 if there is no limit)
 
         @return  (void) no return value
 */
 void 
-runGame (int nJumboMode, int nStepByStepMode, int nHasSounds, int nSmartMode)
+runGame (int nJumboMode, int nStepByStepMode, int nHasSounds, int nSmartMode, int nFrontierMode, int nSensingMode, int nPlanningBudget, int nTurnLimit)
 {
 	//Determines the size of the playing grid
 	int nGridSize;
 	
-	//Initial Locations of LRRH
-	int nLRRHXLocation = 0;
-        int nLRRHYLocation = 0;
-	
-	//Counter for Senses, Rotations, and Movements of LRRH
-	int nNumOfSenses = 0;
-	int nNumOfRotations = 0;
-	int nNumOfMovements = 0;
-	int nNumOfTurns = 0;
-	
-        //Used to tell whether or not LRRH has gotten a certain element
-	int nHasFlower = 0;
-	int nHasBread = 0; 
-	int nVisitedWoodsman = 0;
-        
         //Get the size of the grid from the user
 	getGridSize (&nGridSize, nJumboMode, nHasSounds);
 	
@@ -271,12 +265,25 @@ runGame (int nJumboMode, int nStepByStepMode, int nHasSounds, int nSmartMode)
 	//Contains the tiles that LRRH has already sensed
 	int narrSensedTiles[nGridSize][nGridSize];
 	int narrWalkedTiles[nGridSize][nGridSize];
-	
-	//The viewing direction LRRH is currently facing. Default is south  (DIRECTION_SOUTH)
-	char cLRRHViewDirection = DIRECTION_SOUTH;
-	
-        //Contains the previous tile value that LRRH is currently standing on
-	char cPreviousWalkedTileValue = EMPTY_TILE;
+
+        //Contains the bit planes of what LRRH knows, kept in sync with the sensed and walked tiles
+        KnowledgeMap Knowledge;
+
+        initKnowledgeMap (&Knowledge, nGridSize);
+
+        /*LRRH, her counters and items, and what she knows, kept in one place for the whole game.
+          LRRH starts at (1,1) facing south (DIRECTION_SOUTH)*/
+        GameState Game;
+
+        initGameState (&Game, 
+                        &carrPlayGrid[0][0], 
+                        &narrSensedTiles[0][0], 
+                        &narrWalkedTiles[0][0], 
+                        &Knowledge, 
+                        nGridSize, 
+                        nSensingMode, 
+                        nStepByStepMode, 
+                        nHasSounds);
 	
 	//Loop through and Initialize the Grid values
 	int i, j;
@@ -298,169 +305,209 @@ runGame (int nJumboMode, int nStepByStepMode, int nHasSounds, int nSmartMode)
 	
         //Initialize LRRH's location
 	//LRRH will always start at  (1,1)
-	carrPlayGrid[nLRRHXLocation][nLRRHYLocation] = LRRH_DIRECTION_SOUTH;
-	narrSensedTiles[nLRRHXLocation][nLRRHYLocation] = 1;
-	narrWalkedTiles[nLRRHXLocation][nLRRHYLocation] = 1;
+	carrPlayGrid[Game.nLRRHXLocation][Game.nLRRHYLocation] = LRRH_DIRECTION_SOUTH;
+	updateSensedTile (Game.nLRRHXLocation, Game.nLRRHYLocation, WALKABLE_TILE_VALUE, &narrSensedTiles[0][0], &Knowledge, nGridSize);
+	updateWalkedTile (Game.nLRRHXLocation, Game.nLRRHYLocation, &narrWalkedTiles[0][0], &Knowledge, nGridSize);
 
         //Render (Print) the grid at the very end after all the elements on the Grid have been initialized
-	displayPlayGrid (&carrPlayGrid[0][0], nGridSize, nNumOfSenses, nNumOfRotations, nNumOfMovements);
+	displayPlayGrid (&carrPlayGrid[0][0], nGridSize, Game.nNumOfSenses, Game.nNumOfRotations, Game.nNumOfMovements);
 
 	//Initialize the locations of the objects on the grid
 	initializeObjects (&carrPlayGrid[0][0], nGridSize, nJumboMode, nHasSounds);
 
+        //Solve the board with full knowledge before LRRH changes it, to compare her actions against later
+        int nOptimalNumOfActions = computeOptimalNumOfActions (&carrPlayGrid[0][0], 
+                                                                Game.nLRRHXLocation, 
+                                                                Game.nLRRHYLocation, 
+                                                                Game.cLRRHViewDirection, 
+                                                                nGridSize);
 
-        waitForNextTurn (&nNumOfTurns, nStepByStepMode, nHasSounds);
-        //If smart mode is enabled, make LRRH move intelligently. Else, She will move randomly.
-        if (nSmartMode){
-                runSmartLRRH (&nLRRHXLocation, 
-                                &nLRRHYLocation, 
-                                nGridSize,
-                                &cLRRHViewDirection,
-                                &cPreviousWalkedTileValue,
-                                &carrPlayGrid[0][0], 
-                                &narrSensedTiles[0][0], 
-                                &narrWalkedTiles[0][0], 
-                                &nNumOfSenses, 
-                                &nNumOfRotations, 
-                                &nNumOfMovements, 
-                                &nNumOfTurns,
-                                &nHasFlower,
-                                &nHasBread,
-                                &nVisitedWoodsman,
-                                nStepByStepMode,
-                                nHasSounds);
-        } else 
-        {
-                runRandomLRRH(&nLRRHXLocation, 
-                                &nLRRHYLocation, 
-                                nGridSize,
-                                &cLRRHViewDirection,
-                                &cPreviousWalkedTileValue,
-                                &carrPlayGrid[0][0],
-                                &nNumOfSenses, 
-                                &nNumOfRotations, 
-                                &nNumOfMovements, 
-                                &nNumOfTurns,
-                                &nHasFlower,
-                                &nHasBread,
-                                &nVisitedWoodsman,
-                                nStepByStepMode,
-                                nHasSounds);
-        }
+        //Random numbers of this game only, picked by the seed, the board, and the game (the played game is game 0)
+        unsigned long long ullSeed = (unsigned long long) rand () << 32;
 
+        ullSeed ^= (unsigned long long) rand ();
+        unsigned int unBoardId = hashPlayGrid (&carrPlayGrid[0][0], nGridSize);
 
-        displayEndGameMessage(cPreviousWalkedTileValue, nNumOfSenses, nNumOfRotations, nNumOfMovements, nHasBread, nHasFlower, nVisitedWoodsman);
-}
+        seedRandomGenerator (&Game.Generator, ullSeed, unBoardId, 0);
 
+        //In random mode, the chance of winning can be solved exactly instead of playing many games
+        MarkovAnalysis RandomModeAnalysis;
 
-/* This function makes LRRH perform actions intelligently in the playing grid to achieve her goal.
-        @param   (int *)  pLRRHXLocation is the pointer to nLRRHXLocation (LRRH's X Location)
-        @param   (int *)  pLRRHYLocation is the pointer to nLRRHYLocation (LRRH's Y Location)
+        if (!nSmartMode)
+                analyzeRandomLRRH (&carrPlayGrid[0][0], 
+                                        Game.nLRRHXLocation, 
+                                        Game.nLRRHYLocation, 
+                                        Game.cLRRHViewDirection, 
+                                        nGridSize, 
+                                        &RandomModeAnalysis);
 
-        @param   (char *)  pLRRHViewDirection is the pointer to cLRRHviewDirection (LRRH's viewing direction)
-        @param   (char *)  pPreviousWalkedTileValue is the pointer to cPreviousWalkedTileValue 
-                (The previous value of the tile LRRH is standing)
+        //LRRH changes the playing grid as she walks, so the simulated games of random mode use a copy of the starting board
+        char carrStartingPlayGrid[nGridSize][nGridSize];
 
-        @param   (char *)  pPlayGrid is the pointer to carrPlayGrid
-        @param   (int *)  pWalkedTiles is the pointer to the narrWalkedTiles Array 
-                (Contains information on which tiles LRRH has already walked on)
-        @param   (int *)  pSensedTiles is the pointer to the narrSensedTiles Array 
-                (Contains information on which tiles LRRH has already sensed)
+        memcpy (carrStartingPlayGrid, carrPlayGrid, sizeof(carrPlayGrid));
 
-        @param   (int *)  pNumOfSenses is the pointer to nNumOfSenses (Keeps track of LRRH's sense count)
-        @param   (int *)  pNumOfRotations is the pointer to nNumOfRotations (Keeps track of LRRH's rotation count)
-        @param   (int *)  pNumOfMovements is the pointer to nNumOfMovements (Keeps track of LRRH's movement count)
-        @param   (int *)  pNumOfTurns is the pointer to nNumOfTurns (Keeps track of LRRH's turn count)
+        //Why the game was stopped before reaching an ending, if it was
+        int nStopReason = GAME_STOP_NONE;
 
-        @param   (int)  nGridSize is the size of the playing grid         
+        //The agent that plays LRRH. If smart mode is enabled, she will move intelligently. Else, She will move randomly.
+        Strategy Agent;
+        StrategySettings Settings;
 
-        @param   (int *)  pHasFlower is the pointer to nHasFlower 
-                (Tells whether or not LRRH already has went to a flower field)
-        @param   (int *)  pHasBread is the pointer to nHasBread 
-                (Tells whether or not LRRH already has went to a bakery and the bread has not been eaten yet)
-        @param   (int *)  pVisitedWoodsman is the pointer to nHasBread 
-                (Tells whether or not LRRH already has visited the woodsman's house)
+        Settings.nFrontierMode = nFrontierMode;
+        Settings.nPlanningBudget = nPlanningBudget;
+        Settings.nTurnLimit = nTurnLimit;
 
-        @param   (int)  nStepByStepMode tells whether or not to wait for user input until the next turn
-        @param   (int)  nHasSounds tells whether or not the application should play sound for each turn 
+        if (nSmartMode)
+                initSmartStrategy (&Agent);
+        else
+                initRandomStrategy (&Agent);
+
+        waitForNextTurn (&Game.nNumOfTurns, nStepByStepMode, nHasSounds);
+        nStopReason = runStrategyLRRH (&Game, &Agent, &Settings);
+
+        if (nStopReason == GAME_STOP_TURN_LIMIT)
+                displayTurnLimitMessage (nTurnLimit);
+        else if (nStopReason == GAME_STOP_NO_ENDING)
+                displayNoEndingMessage ();
+
+        displayEndGameMessage(Game.cPreviousWalkedTileValue, Game.nNumOfSenses, Game.nNumOfRotations, Game.nNumOfMovements, Game.nHasBread, Game.nHasFlower, Game.nVisitedWoodsman);
+
+        displayCompetitiveRatio (Game.nNumOfSenses + Game.nNumOfRotations + Game.nNumOfMovements, 
+                                nOptimalNumOfActions, 
+                                Game.cPreviousWalkedTileValue == GRANDMA_TILE && Game.nHasFlower && Game.nHasBread && Game.nVisitedWoodsman);
+
+        if (!nSmartMode){
+                displayRandomModeAnalysis (RandomModeAnalysis.dWinProbability, 
+                                                RandomModeAnalysis.dExpectedNumOfTurns, 
+                                                RandomModeAnalysis.nNumOfIterations);
+
+                //Play many more games on the same board at once (games 1 and up)
+                BatchResult RandomModeBatch;
+
+                simulateRandomLRRHBatch (&carrStartingPlayGrid[0][0], 
+                                        0, 
+                                        0, 
+                                        DIRECTION_SOUTH, 
+                                        nGridSize, 
+                                        ullSeed, 
+                                        unBoardId, 
+                                        1, 
+                                        BATCH_DEFAULT_NUM_OF_GAMES, 
+                                        BATCH_DEFAULT_NUM_OF_THREADS, 
+                                        nTurnLimit, 
+                                        &RandomModeBatch);
+                displayBatchSimulation (RandomModeBatch.nNumOfGames, RandomModeBatch.nNumOfWins, RandomModeBatch.llTotalNumOfTurns);
+        }
+
+        //Free the memory used by the queues of the game
+        clearGameState (&Game);
+}
+
+
+/* This function makes LRRH perform actions intelligently in the playing grid to achieve her goal.
+        @param   (GameState *)  pGame is the pointer to Game (LRRH, her items, what she knows, and her queues)
+
+        @param   (int)  nFrontierMode tells how LRRH will pick the next tile to explore
+        @param   (int)  nPlanningBudget is the number of states the path generation can check in a turn (0 if there is no limit)
         
-        @return  (void) no return value
+        @return  (int) GAME_STOP_NONE if the game reached an ending, or GAME_STOP_NO_PROGRESS if it was stopped 
+                for going around without making progress
 */
-void 
-runSmartLRRH (int * pLRRHXLocation,
-                int * pLRRHYLocation, 
-                int nGridSize,
-                char * pLRRHViewDirection,
-                char * pPreviousWalkedTileValue,
-                char * pPlayGrid, 
-                int * pSensedTiles, 
-                int * pWalkedTiles,
-                int * pNumOfSenses,
-                int * pNumOfRotations,
-                int * pNumOfMovements,
-                int * pNumOfTurns,
-                int * pHasFlower,
-                int * pHasBread,
-                int * pVisitedWoodsman,
-                int nStepByStepMode,
-                int nHasSounds)
+int 
+runSmartLRRH (GameState * pGame,
+                int nFrontierMode,
+                int nPlanningBudget)
 {
-        //Queues used to store the coordinates that LRRH will go to.
-	Queue XGridQueue, YGridQueue;
-
-        //Queue used to store the actions LRRH will do.
-	Queue ActionQueue;
-	
-        //Initialize the queues
-	initQueue (&XGridQueue);
-	initQueue (&YGridQueue);
-	initQueue (&ActionQueue);
-
+        //Limits how many states the path generation can check before LRRH starts walking
+        PlanningBudget Budget;
+
+        initPlanningBudget (&Budget, nPlanningBudget);
+
+        //Plans the path to the next tile in the queue during the pauses between turns
+        SpeculativePlan Plan;
+
+        initSpeculativePlan (&Plan, 
+                                &pGame->nLRRHXLocation, 
+                                &pGame->nLRRHYLocation, 
+                                &pGame->cLRRHViewDirection, 
+                                &pGame->XGridQueue, 
+                                &pGame->YGridQueue, 
+                                pGame->pSensedTiles, 
+                                pGame->pWalkedTiles,
+                                pGame->pKnowledge, 
+                                &Budget, 
+                                pGame->nGridSize,
+                                nFrontierMode,
+                                pGame->nSensingMode);
+
+        //Plays the rollouts that choose the next tile to explore in rollout mode
+        RolloutPlanner Planner;
+
+        if (nFrontierMode == FRONTIER_MODE_ROLLOUT)
+                initRolloutPlanner (&Planner, &pGame->Generator, ROLLOUT_DEFAULT_NUM_OF_ROLLOUTS, ROLLOUT_DEFAULT_NUM_OF_THREADS);
 
 	//Enqueue the starting position to the queue
-	enqueue (&XGridQueue, *pLRRHXLocation);
-	enqueue (&YGridQueue, *pLRRHYLocation);
-
+	enqueue (&pGame->XGridQueue, pGame->nLRRHXLocation);
+	enqueue (&pGame->YGridQueue, pGame->nLRRHYLocation);
 
-	//Used to tell whether or not LRRH has sensed a certain element
-	int nHasSensedBread = 0;
-	int nHasSensedFlower = 0;
-	int nHasSensedWoodsman = 0;
-	int nHasSensedGrandma = 0;
-	
-        //Used to tell whether or not LRRH's bread was taken by the wolf.
-	int nWasBreadTaken = 0;
-	
-        //Used to hold the X and Y coordinates of the wolf
-	int nWolfXCoord = -1;
-	int nWolfYCoord = -1;
 
         //Used to tell whether or not a destination LRRH is going to can be went into.
 	int nIsDestinationValid = 0;
 
+        //Why the game was stopped before reaching an ending
+        int nStopReason = GAME_STOP_NONE;
+
+        /*Used to stop the game loop if it keeps going around without LRRH making progress
+          (Ex: a skippable wolf tile that keeps being put back into the queue)*/
+        int nNumOfIdleIterations = 0;
+        int nIdleIterationLimit = SMART_IDLE_ITERATIONS_PER_TILE * pGame->nGridSize * pGame->nGridSize;
+        int nLastProgress = -1;
+
 	// Start of the Game Loop
 	while (1)
 	{
+                //Sensing a new tile, walking on a new tile, or a change in the items LRRH has all count as progress
+                int nNumOfSensedTiles = countBitboardTiles (&pGame->pKnowledge->SensedPlane);
+                int nNumOfWalkedTiles = countBitboardTiles (&pGame->pKnowledge->WalkedPlane);
+                int nProgress = ((nNumOfSensedTiles + nNumOfWalkedTiles) * 2 + pGame->nHasFlower) * 4 + pGame->nHasBread * 2 + pGame->nVisitedWoodsman;
+
+                if (nProgress != nLastProgress){
+                        nLastProgress = nProgress;
+                        nNumOfIdleIterations = 0;
+                } else if (++nNumOfIdleIterations >= nIdleIterationLimit){
+                        displayNoProgressDiagnostics (nNumOfIdleIterations, 
+                                                        pGame->nLRRHXLocation, 
+                                                        pGame->nLRRHYLocation, 
+                                                        pGame->cLRRHViewDirection, 
+                                                        pGame->nHasFlower, 
+                                                        pGame->nHasBread, 
+                                                        pGame->nVisitedWoodsman, 
+                                                        nNumOfSensedTiles, 
+                                                        nNumOfWalkedTiles, 
+                                                        &pGame->XGridQueue, 
+                                                        &pGame->YGridQueue);
+                        nStopReason = GAME_STOP_NO_PROGRESS;
+                        break;
+                }
 
 		//Dequeue coordinates from the X and Y queues.	
-		int nXGridLocation = dequeue (&XGridQueue);
-		int nYGridLocation = dequeue (&YGridQueue);
+		int nXGridLocation = dequeue (&pGame->XGridQueue);
+		int nYGridLocation = dequeue (&pGame->YGridQueue);
 
                 //If the coordinates are equal to the wolf locations, then check first whether or not the wolf tile is skippable
-		if (nXGridLocation == nWolfXCoord && nYGridLocation == nWolfYCoord){
-			int nIsWolfTileSkippable = isWolfTileSkippable (*pLRRHXLocation, 
-                                                                        *pLRRHYLocation,
+		if (nXGridLocation == pGame->nWolfXCoord && nYGridLocation == pGame->nWolfYCoord){
+			int nIsWolfTileSkippable = isWolfTileSkippable (pGame->nLRRHXLocation, 
+                                                                        pGame->nLRRHYLocation,
 					 				nXGridLocation, 
                                                                         nYGridLocation,
-									pSensedTiles, 
-                                                                        nGridSize,
-                                                                        XGridQueue.nCount);
+									pGame->pKnowledge,
+                                                                        pGame->XGridQueue.nCount);
 			
                         //If so, then enqueue the wolf tile back to the back of the queue and skip its movement
                         if (nIsWolfTileSkippable) 
                         {
-                                enqueue (&XGridQueue, nXGridLocation);
-				enqueue (&YGridQueue, nYGridLocation);
+                                enqueue (&pGame->XGridQueue, nXGridLocation);
+				enqueue (&pGame->YGridQueue, nYGridLocation);
                                 continue;
                         }                                
 		}
@@ -468,201 +515,102 @@ runSmartLRRH (int * pLRRHXLocation,
                 
 
                 //Used to check whether or not all of the special tiles have been sensed by LRRH
-                int nHasSensedAllElements =  (nHasSensedBread && nHasSensedFlower && nHasSensedWoodsman && nHasSensedGrandma);
-
-
-                //If LRRH does not have a flower and has sensed a flower, then move to that location
-		if (!*pHasFlower && nHasSensedFlower){
+                int nHasSensedAllElements =  (pGame->nHasSensedBread && pGame->nHasSensedFlower && pGame->nHasSensedWoodsman && pGame->nHasSensedGrandma);
 
-                        //Get the flower coordinates and then generate a path to there
-			int nFlowerXCoord, nFlowerYCoord;
 
-			recallSensedTile (FLOWER_TILE_VALUE, &nFlowerXCoord, &nFlowerYCoord, pSensedTiles, nGridSize);
-
-			generateAStarPath (*pLRRHXLocation, 
-                                                *pLRRHYLocation,
-				 		nFlowerXCoord, 
-                                                nFlowerYCoord, 
-						pSensedTiles, 
-                                                pPlayGrid,
-                                                nGridSize,
-						&ActionQueue, 
-                                                &nIsDestinationValid);
-			
-                        //If the path generation succeeds, go there
-			if (nIsDestinationValid){
-				moveLRRHToPath (&*pLRRHXLocation, 
-                                                pLRRHYLocation,
-						nFlowerXCoord, 
-                                                nFlowerYCoord,
-						&nWolfXCoord, 
-                                                &nWolfYCoord,
-						&ActionQueue,
-						pNumOfSenses,
-                                                pNumOfRotations, 
-                                                pNumOfMovements, 
-                                                pNumOfTurns,
-						nGridSize,
-						pPlayGrid, 
-                                                pWalkedTiles, 
-                                                pSensedTiles,	
-						pHasFlower, 
-                                                pHasBread, 
-                                                pVisitedWoodsman, 
-                                                &nWasBreadTaken,
-						pLRRHViewDirection, 
-                                                pPreviousWalkedTileValue,
-						nStepByStepMode, 
-                                                nHasSounds);
-			}
-		}
-		
-                //If LRRH does not have a woodsman and has sensed the woodsman, then move to that location
-		if (!*pVisitedWoodsman && nHasSensedWoodsman){
-			
-                        //Get the woodsman coordinates and then generate a path to there
-			int nWoodsmanXCoord, nWoodsmanYCoord;
-
-			recallSensedTile (3, &nWoodsmanXCoord, &nWoodsmanYCoord, pSensedTiles, nGridSize);
-
-			generateAStarPath (*pLRRHXLocation,
-					        *pLRRHYLocation,
-				 		nWoodsmanXCoord, 
-						nWoodsmanYCoord, 
-						pSensedTiles,
-                                                pPlayGrid, 
-						nGridSize,
-						&ActionQueue, 
-						&nIsDestinationValid);
-			
-                        //If the path generation succeeds, go there
-			if (nIsDestinationValid){
-				moveLRRHToPath (pLRRHXLocation, 
-						pLRRHYLocation,
-						nWoodsmanXCoord, 
-						nWoodsmanYCoord,
-						&nWolfXCoord, 
-						&nWolfYCoord,
-						&ActionQueue,
-						pNumOfSenses, 
-						pNumOfRotations, 
-						pNumOfMovements, 
-						pNumOfTurns,
-						nGridSize,
-						pPlayGrid, 
-						pWalkedTiles, 
-						pSensedTiles,	
-						pHasFlower, 
-						pHasBread, 
-						pVisitedWoodsman, 
-						&nWasBreadTaken,
-						pLRRHViewDirection, 
-						pPreviousWalkedTileValue,
-						nStepByStepMode, 
-						nHasSounds);
-			}
-		}
-
-                /*If LRRH has already sensed all elements and does not have bread, then go to the bakery
+                /*Go to the objectives LRRH has sensed and still needs (flower field, woodsman's house, and bakery),
+                  in the order that takes the least number of moves. 
                   LRRH will only go to the bakery after sensing ALL elements because the wolf may or may not eat it.
                   Because of this, to prevent the constant going back of LRRH to the bakery, then LRRH will only do so. */
-
-		if (nHasSensedAllElements && !*pHasBread){
-			/*Bread can be stolen by the wolf. When that happens, 
-                        LRRH has to go to the nearest bakery, 
-                        so first determine the closest one using an FCost calculation.*/
+                int nObjectiveXCoord, nObjectiveYCoord;
+                int nObjectiveValue = chooseNextObjective (pGame->nLRRHXLocation, 
+                                                                pGame->nLRRHYLocation, 
+                                                                pGame->pKnowledge,
+                                                                pGame->nHasFlower, 
+                                                                pGame->nVisitedWoodsman, 
+                                                                pGame->nHasBread, 
+                                                                nHasSensedAllElements,
+                                                                &nObjectiveXCoord, 
+                                                                &nObjectiveYCoord);
+
+		while (nObjectiveValue != UNEXPLORED_TILE_VALUE){
+
+                        //Generate a path to the chosen objective
+			generateAStarPath (pGame->nLRRHXLocation, 
+                                                pGame->nLRRHYLocation,
+                                                pGame->cLRRHViewDirection,
+				 		nObjectiveXCoord, 
+                                                nObjectiveYCoord, 
+						pGame->pSensedTiles, 
+						pGame->pKnowledge,
+                                                pGame->pPlayGrid,
+                                                pGame->nGridSize,
+						&pGame->ActionQueue, 
+                                                &nIsDestinationValid,
+                                                &Budget);
 			
-                        //Get the bakery coordinates and then generate a path to there
-                        int nBakeryXCoord, nBakeryYCoord;
-
-			generatePathToClosestBakery (*pLRRHXLocation,
-							*pLRRHYLocation,
-							&nBakeryXCoord, 
-							&nBakeryYCoord,
-                                                        &nHasSensedBread,
-							pSensedTiles, 
-                                                        pPlayGrid,
-							nGridSize,
-							&ActionQueue, 
-							&nIsDestinationValid);
-
-                        //If the path generation succeeds, go there
+                        //If the path generation succeeds, go there.
+                        //If not, the objective has been marked as unwalkable and will not be chosen again.
 			if (nIsDestinationValid){
-				moveLRRHToPath (pLRRHXLocation, 
-						pLRRHYLocation,
-						nBakeryXCoord, 
-						nBakeryYCoord,
-						&nWolfXCoord,
-						&nWolfYCoord,
-						&ActionQueue,
-						pNumOfSenses, 
-						pNumOfRotations, 
-						pNumOfMovements, 
-						pNumOfTurns,
-						nGridSize,
-						pPlayGrid, 
-						pWalkedTiles, 
-						pSensedTiles,	
-						pHasFlower, 
-						pHasBread, 
-						pVisitedWoodsman, 
-						&nWasBreadTaken,
-						pLRRHViewDirection, 
-						pPreviousWalkedTileValue,
-						nStepByStepMode, 
-						nHasSounds);
+				moveLRRHToPath (pGame, nObjectiveXCoord, nObjectiveYCoord);
+
+                                //Stop going to the objectives if LRRH has been eaten by the wolf
+                                if (pGame->cPreviousWalkedTileValue == WOLF_TILE && !pGame->nWasBreadTaken)
+                                        break;
 			}
+
+                        //Choose the next objective from where LRRH is now
+                        nObjectiveValue = chooseNextObjective (pGame->nLRRHXLocation, 
+                                                                pGame->nLRRHYLocation, 
+                                                                pGame->pKnowledge,
+                                                                pGame->nHasFlower, 
+                                                                pGame->nVisitedWoodsman, 
+                                                                pGame->nHasBread, 
+                                                                nHasSensedAllElements,
+                                                                &nObjectiveXCoord, 
+                                                                &nObjectiveYCoord);
 		}
 
+                //If every bakery LRRH has sensed turned out to be unreachable, LRRH cannot sense the bakeries anymore
+                if (nHasSensedAllElements && !pGame->nHasBread && countBitboardTiles (&pGame->pKnowledge->BakeryPlane) == 0)
+                        pGame->nHasSensedBread = 0;
+
                 //Check whether or not LRRH has gotten all elements, is so, she can then go to Granny's house.
-                int nIsGrannyApproachable =  (*pHasBread && *pHasFlower && *pVisitedWoodsman && nHasSensedGrandma);
+                pGame->nIsGrannyApproachable =  (pGame->nHasBread && pGame->nHasFlower && pGame->nVisitedWoodsman && pGame->nHasSensedGrandma);
 
-		if (nIsGrannyApproachable){
+		if (pGame->nIsGrannyApproachable){
                         
                         //Get the granny coordinates and then generate a path to there
 			int nGrannyXCoord, nGrannyYCoord;
 
-			recallSensedTile (GRANDMA_TILE_VALUE, &nGrannyXCoord, &nGrannyYCoord, pSensedTiles, nGridSize);
+			recallSensedTile (GRANDMA_TILE_VALUE, &nGrannyXCoord, &nGrannyYCoord, pGame->pKnowledge);
 			
                         //Update the sensed tiles array to make granny's location approachable.
 			
-                        *(pSensedTiles + nGrannyXCoord * nGridSize + nGrannyYCoord) = GRANDMA_TILE_VALUE;
-
-			generateAStarPath (*pLRRHXLocation, 
-						*pLRRHYLocation, 
-						nGrannyXCoord,
-					        nGrannyYCoord, 
-						pSensedTiles,
-                                                pPlayGrid, 
-						nGridSize, 
-						&ActionQueue, 
-						&nIsDestinationValid);
-
-                        //If the path generation succeeds, go there
-			if (nIsDestinationValid){
-				moveLRRHToPath (pLRRHXLocation,
-						pLRRHYLocation, 
-						nGrannyXCoord,
-						nGrannyYCoord,
-						&nWolfXCoord, 
-						&nWolfYCoord,
-						&ActionQueue, 
-						pNumOfSenses, 
-						pNumOfRotations, 
-						pNumOfMovements, 
-						pNumOfTurns,
-						nGridSize, 
-						pPlayGrid,
-						pWalkedTiles,	
-						pSensedTiles,	
-						pHasFlower, 
-						pHasBread, 
-						pVisitedWoodsman, 
-						&nWasBreadTaken,
-						pLRRHViewDirection, 
-						pPreviousWalkedTileValue, 
-						nStepByStepMode, 
-						nHasSounds);
+                        updateSensedTile (nGrannyXCoord, nGrannyYCoord, GRANDMA_TILE_VALUE, pGame->pSensedTiles, pGame->pKnowledge, pGame->nGridSize);
+
+			//A path cut short by the planning budget only goes part of the way, so keep going until LRRH gets there
+			nIsDestinationValid = 1;
+
+			while (nIsDestinationValid && pGame->cPreviousWalkedTileValue != GRANDMA_TILE && 
+			       !(pGame->cPreviousWalkedTileValue == WOLF_TILE && !pGame->nWasBreadTaken)){
+				generateAStarPath (pGame->nLRRHXLocation, 
+							pGame->nLRRHYLocation, 
+							pGame->cLRRHViewDirection,
+							nGrannyXCoord,
+						        nGrannyYCoord, 
+							pGame->pSensedTiles,
+							pGame->pKnowledge,
+                                                        pGame->pPlayGrid, 
+							pGame->nGridSize, 
+							&pGame->ActionQueue, 
+							&nIsDestinationValid,
+							&Budget);
+
+                                //If the path generation succeeds, go there
+				if (nIsDestinationValid){
+					moveLRRHToPath (pGame, nGrannyXCoord, nGrannyYCoord);
+				}
 			}
 
                         //Break from the game loop and check the end game scenario
@@ -670,95 +618,93 @@ runSmartLRRH (int * pLRRHXLocation,
 		}
 		
 	        //Check if LRRH is not currently in the dequeued location, then go to that location
-		if ( (nXGridLocation != *pLRRHXLocation || nYGridLocation != *pLRRHYLocation)){
+		if ( (nXGridLocation != pGame->nLRRHXLocation || nYGridLocation != pGame->nLRRHYLocation)){
 				
 			//If LRRH is not there, move LRRH to that location
-			generateAStarPath (*pLRRHXLocation,
-					        *pLRRHYLocation, 
-						nXGridLocation, 
-						nYGridLocation, 
-						pSensedTiles, 
-                                                pPlayGrid,
-						nGridSize, 
-						&ActionQueue, 
-						&nIsDestinationValid);
+                        //In path distance mode, go to the queued tile that takes the least moves instead
+                        if (nFrontierMode == FRONTIER_MODE_PATH_DISTANCE)
+                                generateBFSPathToClosestTile (pGame->nLRRHXLocation,
+                                                                pGame->nLRRHYLocation, 
+                                                                &nXGridLocation, 
+                                                                &nYGridLocation, 
+                                                                &pGame->XGridQueue, 
+                                                                &pGame->YGridQueue, 
+                                                                pGame->pSensedTiles, 
+                                                                pGame->pKnowledge,
+                                                                pGame->pPlayGrid,
+                                                                pGame->nGridSize, 
+                                                                &pGame->ActionQueue, 
+                                                                &nIsDestinationValid);
+                        else if (!adoptSpeculativePlan (&Plan, nXGridLocation, nYGridLocation, pGame->pPlayGrid, &pGame->ActionQueue, &nIsDestinationValid))
+			        generateAStarPath (pGame->nLRRHXLocation,
+					                pGame->nLRRHYLocation, 
+					                pGame->cLRRHViewDirection,
+						        nXGridLocation, 
+						        nYGridLocation, 
+						        pGame->pSensedTiles, 
+						        pGame->pKnowledge,
+                                                        pGame->pPlayGrid,
+						        pGame->nGridSize, 
+						        &pGame->ActionQueue, 
+						        &nIsDestinationValid,
+						        &Budget);
 			
-                        //If the path generation succeeds, go there while sensing the adjacent tiles
+                        /*If the path generation succeeds, go there while sensing the adjacent tiles.
+                          During the pauses on the way, plan the path to the tile that will be at the front of the queue once she gets there.
+                          The rollout mode only knows that tile after its rollouts, so it does not plan on the way.*/
 			if (nIsDestinationValid){
-				moveLRRHToPathWhileSensing (pLRRHXLocation, 
-						                pLRRHYLocation, 
-						         	nXGridLocation, 
-								nYGridLocation,
-								&nWolfXCoord, 
-							        &nWolfYCoord,
-								&ActionQueue, 
-								&XGridQueue, 
-								&YGridQueue,
-								pNumOfSenses, 
-								pNumOfRotations, 
-								pNumOfMovements, 
-								pNumOfTurns,
-								nGridSize, 
-								pPlayGrid,	
-								pWalkedTiles,	
-								pSensedTiles,		
-								pHasFlower, 
-								pHasBread, 
-								pVisitedWoodsman, 
-								&nWasBreadTaken, 
-								&nHasSensedBread, 
-								&nHasSensedFlower, 
-								&nHasSensedWoodsman, 
-								&nHasSensedGrandma, 
-								&nIsGrannyApproachable,
-								pLRRHViewDirection, 
-								pPreviousWalkedTileValue, 
-								nStepByStepMode, 
-								nHasSounds);
+                                if (nFrontierMode != FRONTIER_MODE_PATH_DISTANCE && nFrontierMode != FRONTIER_MODE_ROLLOUT)
+                                        setPendingSpeculativePlan (&Plan, 1);
+
+				moveLRRHToPathWhileSensing (pGame, nXGridLocation, nYGridLocation);
+
+                                setPendingSpeculativePlan (NULL, 0);
+
+                                //If the path was cut short by the planning budget, keep the tile in the queue to go there later
+                                if ((pGame->nLRRHXLocation != nXGridLocation || pGame->nLRRHYLocation != nYGridLocation) &&
+                                    pGame->cPreviousWalkedTileValue != GRANDMA_TILE && 
+                                    !(pGame->cPreviousWalkedTileValue == WOLF_TILE && !pGame->nWasBreadTaken)){
+                                        enqueue (&pGame->XGridQueue, nXGridLocation);
+                                        enqueue (&pGame->YGridQueue, nYGridLocation);
+                                }
 			}				
 		}
 		
-                //If the current queue count is greater than 1, then remove tiles already walked on by LRRH from the queue.
-                //Also, sort the coordinates in the queue by distance
-		if (XGridQueue.nCount > 1){
-			removeWalkedCoordinatesFromQueue (&XGridQueue, &YGridQueue, pWalkedTiles, nGridSize);
-			sortCoordinatesByDistance (&XGridQueue, &YGridQueue, *pLRRHXLocation, *pLRRHYLocation);
-		}
+                //Remove the tiles LRRH is done with from the queue, then sort the rest to choose the next tile to explore
+                orderFrontierQueue (&pGame->XGridQueue, 
+                                        &pGame->YGridQueue, 
+                                        pGame->nLRRHXLocation, 
+                                        pGame->nLRRHYLocation, 
+                                        pGame->pWalkedTiles, 
+                                        pGame->pKnowledge, 
+                                        pGame->nGridSize, 
+                                        nFrontierMode, 
+                                        pGame->nSensingMode);
+
+                //In rollout mode, the rollouts choose which of the tiles at the front of the queue goes first
+                if (nFrontierMode == FRONTIER_MODE_ROLLOUT)
+                        chooseRolloutFrontierTile (&Planner, pGame);
 		
 
+                /*While LRRH senses the tiles around her, plan the path to the next tile in the queue during each pause.
+                  The path distance mode picks its next tile with its own search, so there is nothing to plan for it.*/
+                if (nFrontierMode != FRONTIER_MODE_PATH_DISTANCE)
+                        setPendingSpeculativePlan (&Plan, 0);
+
                 //Prevent LRRH from rotating if she is about to view an already sensed tile
 		//Add function in the movement system to allow LRRH to sense what is in front of her as well.
-		senseAndQueueLRRHAdjacentTiles (pLRRHXLocation,
-                                                pLRRHYLocation,
-                                                &nWolfXCoord, 
-                                                &nWolfYCoord,
-                                                pSensedTiles, 
-                                                pPlayGrid, 
-                                                pLRRHViewDirection, 
-                                                nGridSize,
-                                                pNumOfSenses, 
-                                                pNumOfRotations, 
-                                                pNumOfMovements, 
-                                                pNumOfTurns,
-                                                &nIsGrannyApproachable, 
-                                                pHasBread, 
-                                                &nHasSensedBread, 
-                                                &nHasSensedFlower, 
-                                                &nHasSensedWoodsman, 
-                                                &nHasSensedGrandma,
-                                                &XGridQueue, 
-                                                &YGridQueue, 
-                                                nStepByStepMode, 
-                                                nHasSounds);
+		senseAndQueueLRRHAdjacentTiles (pGame, EMPTY_TILE);
+
+                setPendingSpeculativePlan (NULL, 0);
 
 		/*	
 		If ANY OF THE POSSIBLE ENDINGS HAS OCCURED (Fall to Pit, Eaten by Wolf, Went to Grandma, Sensed Every Tile),
                 BREAK FROM THE LOOP */
-		int nHasScenarioHappened =  ((XGridQueue.nCount == 0) ||
-					*pPreviousWalkedTileValue == PIT_TILE ||
-					*pPreviousWalkedTileValue == GRANDMA_TILE ||
-					(*pPreviousWalkedTileValue == WOLF_TILE && !nWasBreadTaken) ||
-					sensedEveryTile (pSensedTiles, nGridSize));
+		int nHasScenarioHappened =  ((pGame->XGridQueue.nCount == 0) ||
+					pGame->cPreviousWalkedTileValue == PIT_TILE ||
+					pGame->cPreviousWalkedTileValue == GRANDMA_TILE ||
+					(pGame->cPreviousWalkedTileValue == WOLF_TILE && !pGame->nWasBreadTaken) ||
+					sensedEveryTile (pGame->pKnowledge));
 		
 		if (nHasScenarioHappened) 
                         break;
@@ -767,247 +713,204 @@ runSmartLRRH (int * pLRRHXLocation,
 	//ALL CODE HERE PERTAINS TO WHEN A SCENARIO HAS HAPPENED  (LITTLE RED RIDING HOOD HAS REACHED THE END OF HER STORY)
 
         //If LRRH has already sensed every tile & has sensed grandma & LRRH is currently not on grandma's doll
-	if  (sensedEveryTile (pSensedTiles, nGridSize) && nHasSensedGrandma && *pPreviousWalkedTileValue != GRANDMA_TILE){
+	if  (nStopReason == GAME_STOP_NONE && sensedEveryTile (pGame->pKnowledge) && pGame->nHasSensedGrandma && pGame->cPreviousWalkedTileValue != GRANDMA_TILE){
 
                 //Look for the granny coordinates
 		int nGrannyXCoord = -1;
                 int nGrannyYCoord = -1;
 			
-		recallSensedTile (GRANDMA_TILE_VALUE, &nGrannyXCoord, &nGrannyYCoord, pSensedTiles, nGridSize);
+		recallSensedTile (GRANDMA_TILE_VALUE, &nGrannyXCoord, &nGrannyYCoord, pGame->pKnowledge);
 			
 		
                 //AT THE START, DO NOT ALLOW LRRH do go to Granny's tile
-		*(pSensedTiles + nGrannyXCoord * nGridSize + nGrannyYCoord) = -GRANDMA_TILE_VALUE;
+		updateSensedTile (nGrannyXCoord, nGrannyYCoord, -GRANDMA_TILE_VALUE, pGame->pSensedTiles, pGame->pKnowledge, pGame->nGridSize);
+
+                /*The last tile LRRH sensed may have been a flower field or the woodsman's house, 
+                  which the game loop stopped before going to. Go to the ones still needed first.*/
+                int nObjectiveXCoord, nObjectiveYCoord;
+                int nObjectiveValue = chooseNextObjective (pGame->nLRRHXLocation, 
+                                                                pGame->nLRRHYLocation, 
+                                                                pGame->pKnowledge,
+                                                                pGame->nHasFlower, 
+                                                                pGame->nVisitedWoodsman, 
+                                                                pGame->nHasBread, 
+                                                                0,
+                                                                &nObjectiveXCoord, 
+                                                                &nObjectiveYCoord);
+
+		while (nObjectiveValue != UNEXPLORED_TILE_VALUE){
+			generateAStarPath (pGame->nLRRHXLocation, 
+                                                pGame->nLRRHYLocation,
+                                                pGame->cLRRHViewDirection,
+				 		nObjectiveXCoord, 
+                                                nObjectiveYCoord, 
+						pGame->pSensedTiles, 
+						pGame->pKnowledge,
+                                                pGame->pPlayGrid,
+                                                pGame->nGridSize,
+						&pGame->ActionQueue, 
+                                                &nIsDestinationValid,
+                                                &Budget);
+			
+			if (nIsDestinationValid){
+				moveLRRHToPath (pGame, nObjectiveXCoord, nObjectiveYCoord);
+
+                                if (pGame->cPreviousWalkedTileValue == WOLF_TILE && !pGame->nWasBreadTaken)
+                                        break;
+			}
+
+                        nObjectiveValue = chooseNextObjective (pGame->nLRRHXLocation, 
+                                                                pGame->nLRRHYLocation, 
+                                                                pGame->pKnowledge,
+                                                                pGame->nHasFlower, 
+                                                                pGame->nVisitedWoodsman, 
+                                                                pGame->nHasBread, 
+                                                                0,
+                                                                &nObjectiveXCoord, 
+                                                                &nObjectiveYCoord);
+		}
 		
                 //If LRRH has sensed a bakery and has not gotten a bread, go to the closest bakery
-		if (!*pHasBread && nHasSensedBread){
+		if (!pGame->nHasBread && pGame->nHasSensedBread){
 
 			/*Bread can be stolen by the wolf. When that happens, LRRH has to go to the nearest bakery.*/
 			int nBakeryXCoord = -1;
                         int nBakeryYCoord = -1;
 
-			generatePathToClosestBakery (*pLRRHXLocation,
-							*pLRRHYLocation, 
-							&nBakeryXCoord, 
-							&nBakeryYCoord, 
-                                                        &nHasSensedBread,
-							pSensedTiles, 
-                                                        pPlayGrid,
-							nGridSize, 
-							&ActionQueue, 
-							&nIsDestinationValid);
+			//A path cut short by the planning budget only goes part of the way, so keep going until LRRH gets there
+			nIsDestinationValid = 1;
+
+			while (nIsDestinationValid && !pGame->nHasBread && pGame->nHasSensedBread && 
+			       !(pGame->cPreviousWalkedTileValue == WOLF_TILE && !pGame->nWasBreadTaken)){
+				generatePathToClosestBakery (pGame->nLRRHXLocation,
+								pGame->nLRRHYLocation, 
+								pGame->cLRRHViewDirection,
+								&nBakeryXCoord, 
+								&nBakeryYCoord, 
+                                                                &pGame->nHasSensedBread,
+								pGame->pSensedTiles, 
+								pGame->pKnowledge,
+                                                                pGame->pPlayGrid,
+								pGame->nGridSize, 
+								&pGame->ActionQueue, 
+								&nIsDestinationValid,
+								&Budget);
 			
-                        //If the path generation succeeds, go to the bakery
-			if (nIsDestinationValid){
-				moveLRRHToPath (pLRRHXLocation,
-						pLRRHYLocation, 
-						nBakeryXCoord, 
-						nBakeryYCoord,
-						&nWolfXCoord, 
-						&nWolfYCoord,
-						&ActionQueue, 
-						pNumOfSenses, 
-						pNumOfRotations, 
-						pNumOfMovements, 
-						pNumOfTurns,
-						nGridSize, 
-						pPlayGrid,
-						pWalkedTiles,	
-						pSensedTiles,	
-						pHasFlower, 
-						pHasBread, 
-						pVisitedWoodsman, 
-						&nWasBreadTaken,
-						pLRRHViewDirection, 
-						pPreviousWalkedTileValue, 
-						nStepByStepMode, 
-						nHasSounds);
-			}		
+                                //If the path generation succeeds, go to the bakery
+				if (nIsDestinationValid){
+					moveLRRHToPath (pGame, nBakeryXCoord, nBakeryYCoord);
+
+					if (pGame->nLRRHXLocation == nBakeryXCoord && pGame->nLRRHYLocation == nBakeryYCoord)
+					        break;
+				}		
+			}
 		}
 		
                 //After going to the bakery, then allow LRRH to go to Granny's house now
-		*(pSensedTiles + nGrannyXCoord * nGridSize + nGrannyYCoord) = GRANDMA_TILE_VALUE;
+		updateSensedTile (nGrannyXCoord, nGrannyYCoord, GRANDMA_TILE_VALUE, pGame->pSensedTiles, pGame->pKnowledge, pGame->nGridSize);
 		
-		generateAStarPath (*pLRRHXLocation,
-				        *pLRRHYLocation, 
-					nGrannyXCoord, 
-					nGrannyYCoord, 
-					pSensedTiles,
-                                        pPlayGrid, 
-					nGridSize, 
-					&ActionQueue, 
-					&nIsDestinationValid);
+		//A path cut short by the planning budget only goes part of the way, so keep going until LRRH gets there
+		nIsDestinationValid = 1;
+
+		while (nIsDestinationValid && pGame->cPreviousWalkedTileValue != GRANDMA_TILE && 
+		       !(pGame->cPreviousWalkedTileValue == WOLF_TILE && !pGame->nWasBreadTaken)){
+			generateAStarPath (pGame->nLRRHXLocation,
+					        pGame->nLRRHYLocation, 
+					        pGame->cLRRHViewDirection,
+						nGrannyXCoord, 
+						nGrannyYCoord, 
+						pGame->pSensedTiles,
+						pGame->pKnowledge,
+                                                pGame->pPlayGrid, 
+						pGame->nGridSize, 
+						&pGame->ActionQueue, 
+						&nIsDestinationValid,
+						&Budget);
 		
-		if (nIsDestinationValid){
-			moveLRRHToPath (pLRRHXLocation,
-					pLRRHYLocation, 
-					nGrannyXCoord, 
-					nGrannyYCoord,
-					&nWolfXCoord, 
-					&nWolfYCoord,
-					&ActionQueue, 
-					pNumOfSenses, 
-					pNumOfRotations, 
-					pNumOfMovements, 
-					pNumOfTurns,
-					nGridSize, 
-					pPlayGrid,	
-					pWalkedTiles, 
-					pSensedTiles,			
-					pHasFlower, 
-					pHasBread, 
-					pVisitedWoodsman, 
-					&nWasBreadTaken,
-					pLRRHViewDirection, 
-					pPreviousWalkedTileValue, 
-					nStepByStepMode, 
-					nHasSounds);
+			if (nIsDestinationValid){
+				moveLRRHToPath (pGame, nGrannyXCoord, nGrannyYCoord);
+			}
 		}
 	}
-}
 
-/* This function makes LRRH do actions randomly around the playing grid
-        @param   (int *)  pLRRHXLocation is the pointer to nLRRHXLocation (LRRH's X Location)
-        @param   (int *)  pLRRHYLocation is the pointer to nLRRHYLocation (LRRH's Y Location)
+        //Free the memory used by the speculative plan and the rollouts
+        clearSpeculativePlan (&Plan);
 
-        @param   (char *)  pLRRHViewDirection is the pointer to cLRRHviewDirection (LRRH's viewing direction)
-        @param   (char *)  pPreviousWalkedTileValue is the pointer to cPreviousWalkedTileValue 
-                (The previous value of the tile LRRH is standing)
+        if (nFrontierMode == FRONTIER_MODE_ROLLOUT)
+                clearRolloutPlanner (&Planner);
 
-        @param   (char *)  pPlayGrid is the pointer to carrPlayGrid
-
-        @param   (int *)  pNumOfSenses is the pointer to nNumOfSenses (Keeps track of LRRH's sense count)
-        @param   (int *)  pNumOfRotations is the pointer to nNumOfRotations (Keeps track of LRRH's rotation count)
-        @param   (int *)  pNumOfMovements is the pointer to nNumOfMovements (Keeps track of LRRH's movement count)
-        @param   (int *)  pNumOfTurns is the pointer to nNumOfTurns (Keeps track of LRRH's turn count)
-
-        @param   (int)  nGridSize is the size of the playing grid         
+        return nStopReason;
+}
 
-        @param   (int *)  pHasFlower is the pointer to nHasFlower 
-                (Tells whether or not LRRH already has went to a flower field)
-        @param   (int *)  pHasBread is the pointer to nHasBread 
-                (Tells whether or not LRRH already has went to a bakery and the bread has not been eaten yet)
-        @param   (int *)  pVisitedWoodsman is the pointer to nHasBread 
-                (Tells whether or not LRRH already has visited the woodsman's house)
+/* This function fills in the functions of smart mode, which plays the whole game in its own loop (runSmartLRRH)
+        @param   (Strategy *)  pStrategy is the pointer to the strategy to fill in
 
-        @param   (int)  nStepByStepMode tells whether or not to wait for user input until the next turn
-        @param   (int)  nHasSounds tells whether or not the application should play sound for each turn 
-        
         @return  (void) no return value
 */
 void
-runRandomLRRH (int * pLRRHXLocation,
-                int * pLRRHYLocation, 
-                int nGridSize,
-                char * pLRRHViewDirection,
-                char * pPreviousWalkedTileValue,
-                char * pPlayGrid,
-                int * pNumOfSenses,
-                int * pNumOfRotations,
-                int * pNumOfMovements,
-                int * pNumOfTurns,
-                int * pHasFlower,
-                int * pHasBread,
-                int * pVisitedWoodsman,
-                int nStepByStepMode,
-                int nHasSounds)
+initSmartStrategy (Strategy * pStrategy)
 {
+        pStrategy->pInitAgent = initSmartAgent;
+        pStrategy->pClearAgent = NULL;
+        pStrategy->pDecideAction = NULL;
+        pStrategy->pObserveSense = NULL;
+        pStrategy->pPlayGame = playSmartGame;
+}
 
-        //Used to tell whether or not LRRH's bread was taken by the wolf.
-        int nWasBreadTaken = 0;
-
-        //Holds a random number that will decide LRRH's next course of action
-        int nRandomNumber = 0;
-        while (1){
-
-                //Generate a random number from 0 to 100
-                nRandomNumber = generateRandomNumber(0, 100);
+/* This function sets up smart mode for a game. The settings outlive the game, so they are all smart mode keeps.
+        @param   (GameState *)  pGame is the pointer to Game
+        @param   (StrategySettings *)  pSettings is the pointer to the settings smart mode is played with
 
-                //get LRRH's current location
-                char * pLRRHTile = (pPlayGrid +  (*pLRRHXLocation) * nGridSize +  (*pLRRHYLocation));
+        @return  (void *) the pointer to the settings
+*/
+void *
+initSmartAgent (GameState * pGame,
+                StrategySettings * pSettings)
+{
+        return pSettings;
+}
 
+/* This function plays the whole game with smart mode
+        @param   (void *)  pAgent is the pointer to the settings smart mode is played with
+        @param   (GameState *)  pGame is the pointer to Game
 
+        @return  (int) the GAME_STOP value runSmartLRRH gives
+*/
+int
+playSmartGame (void * pAgent,
+                GameState * pGame)
+{
+        StrategySettings * pSettings = pAgent;
 
-                /*LRRH will perform a different action depending on the range of values generated by the RNG:
-                0 - 16: Rotate to the left
-                17 - 50: Move forward (If possible, else, do nothing)
-                51 - 67: Rotate to the right
-                68 - 100: Sense the tile she is facing*/
+        return runSmartLRRH (pGame, pSettings->nFrontierMode, pSettings->nPlanningBudget);
+}
 
-                if (nRandomNumber >= 0 && nRandomNumber <= 8)
-                        rotateLeftLRRH(pNumOfRotations, pLRRHViewDirection, pLRRHTile);
-                else if (nRandomNumber >= 9 && nRandomNumber <= 61) {
-                        //Convert the character Direction to X and Y components
-                        int nXDirection = convertDirectionSymbolToXMovement (*pLRRHViewDirection);
-                        int nYDirection = convertDirectionSymbolToYMovement (*pLRRHViewDirection);
+/* This function fills in the functions of random mode, which decides one action at a time and keeps nothing of its own
+        @param   (Strategy *)  pStrategy is the pointer to the strategy to fill in
 
-                        //Check first whether or not it is possible to move onto the tile before doing so.
-                        if (isLocationValid(nXDirection + *pLRRHXLocation, nYDirection + *pLRRHYLocation, nGridSize - 1)){
-                                *pPreviousWalkedTileValue = forwardLRRH(pNumOfMovements, 
-                                                                        pLRRHXLocation, 
-                                                                        pLRRHYLocation, 
-                                                                        pLRRHTile, 
-                                                                        pLRRHViewDirection, 
-                                                                        nGridSize, 
-                                                                        *pPreviousWalkedTileValue);
+        @return  (void) no return value
+*/
+void
+initRandomStrategy (Strategy * pStrategy)
+{
+        pStrategy->pInitAgent = NULL;
+        pStrategy->pClearAgent = NULL;
+        pStrategy->pDecideAction = decideRandomAction;
+        pStrategy->pObserveSense = NULL;
+        pStrategy->pPlayGame = NULL;
+}
 
-                                //Perform a switch case after moving to check whether or not LRRH has reached a special tile.
-                                switch (*pPreviousWalkedTileValue){
-                                case FLOWER_TILE:
-                                *pHasFlower = 1;
-                                        break;
-                                case BAKERY_TILE:
-                                        *pHasBread = 1;
-                                        nWasBreadTaken = 0;
-                                        break;
-                                case WOODSMAN_TILE:
-                                        *pVisitedWoodsman = 1;
-                                                
-                                        /*Proceed to calculate the distance from the woodsman and grandma's house 
-                                        and display it to the user.*/
-                                        int nWoodsmanDistance = computeWoodsmanDistance (pPlayGrid, nGridSize);
-                                        displayWoodsmanLocation (nWoodsmanDistance);
-                                        break;			
-                                case WOLF_TILE:
-                                        
-                                        /*If LRRH is on the wolf tile, check whether or not she has bread
-                                        If she does, she just loses the bread and cannot go to the wolf again or else,
-                                        she will die and the game is lost.
-                                        */
-                                        if (*pHasBread){
-
-                                                *pHasBread = 0;
-                                                nWasBreadTaken = 1;
-                                                displayWolfEatingBread ();
-                                        } else 
-                                                nWasBreadTaken = 0;
-                                        break;
-                                }
-                        } else {
-                                //If LRRH cannot move forward, rotate instead
-                                rotateRightLRRH (pNumOfRotations, pLRRHViewDirection, pLRRHTile);
-                        }
-		} else if (nRandomNumber >= 62 && nRandomNumber <= 67)
-                        rotateRightLRRH (pNumOfRotations, pLRRHViewDirection, pLRRHTile);
-                else
-                        senseLRRH (pNumOfSenses, pLRRHXLocation, pLRRHYLocation, pLRRHTile, pLRRHViewDirection, nGridSize);
-                
+/* This function makes LRRH pick her next action randomly, with the random numbers of the game
+        @param   (void *)  pAgent is not used (random mode keeps nothing of its own)
+        @param   (GameState *)  pGame is the pointer to Game
 
-                //Display the play grid to the user after every turn
-                displayPlayGrid (pPlayGrid, nGridSize, *pNumOfSenses, *pNumOfRotations, *pNumOfMovements);
-                waitForNextTurn (pNumOfTurns, nStepByStepMode, nHasSounds);
-                        
-                
-                
-                /*After performing an action, check first if you have triggered a tile event	
-		If ANY OF THE POSSIBLE ENDINGS HAS OCCURED, BREAK FROM THE LOOP */
-		int nHasScenarioHappened =  (*pPreviousWalkedTileValue == PIT_TILE ||
-					        *pPreviousWalkedTileValue == GRANDMA_TILE ||
-					        (*pPreviousWalkedTileValue == WOLF_TILE && !nWasBreadTaken));
-		
-		if (nHasScenarioHappened) 
-                        break;
-        }
+        @return  (int) the GAME_ACTION picked
+*/
+int
+decideRandomAction (void * pAgent,
+                        GameState * pGame)
+{
+        return chooseRandomAction (&pGame->Generator);
 }
 
 
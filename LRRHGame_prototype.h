@@ -3,7 +3,7 @@
 *
 * Description:
 * 	LRRHGame_prototype.h: Contains the function prototypes of LRRHGame.c
-* Last Modified: 28/01/2022
+* Last Modified: 19/10/2026
 */
 
 
@@ -21,39 +21,22 @@ void    initializeObjects       (char * pPlayGrid,
 void    runGame                 (int nJumboMode, 
                                 int nStepByStepMode, 
                                 int nHasSounds,
-                                int nSmartMode);
-void    runSmartLRRH            (int * pLRRHXLocation,
-                                int * pLRRHYLocation, 
-                                int nGridSize,
-                                char * pLRRHViewDirection,
-                                char * pPreviousWalkedTileValue,
-                                char * pPlayGrid, 
-                                int * pSensedTiles, 
-                                int * pWalkedTiles,
-                                int * pNumOfSenses,
-                                int * pNumOfRotations,
-                                int * pNumOfMovements,
-                                int * pNumOfTurns,
-                                int * pHasFlower,
-                                int * pHasBread,
-                                int * pVisitedWoodsman,
-                                int nStepByStepMode,
-                                int nHasSounds);
-void    runRandomLRRH           (int * pLRRHXLocation,
-                                int * pLRRHYLocation, 
-                                int nGridSize,
-                                char * pLRRHViewDirection,
-                                char * pPreviousWalkedTileValue,
-                                char * pPlayGrid,
-                                int * pNumOfSenses,
-                                int * pNumOfRotations,
-                                int * pNumOfMovements,
-                                int * pNumOfTurns,
-                                int * pHasFlower,
-                                int * pHasBread,
-                                int * pVisitedWoodsman,
-                                int nStepByStepMode,
-                                int nHasSounds);
+                                int nSmartMode,
+                                int nFrontierMode,
+                                int nSensingMode,
+                                int nPlanningBudget,
+                                int nTurnLimit);
+int     runSmartLRRH            (GameState * pGame,
+                                int nFrontierMode,
+                                int nPlanningBudget);
+void    initSmartStrategy       (Strategy * pStrategy);
+void *  initSmartAgent          (GameState * pGame,
+                                StrategySettings * pSettings);
+int     playSmartGame           (void * pAgent,
+                                GameState * pGame);
+void    initRandomStrategy      (Strategy * pStrategy);
+int     decideRandomAction      (void * pAgent,
+                                GameState * pGame);
 void    displayEndGameMessage   (char cPreviousWalkedTileValue,
                                 int nNumOfSenses, 
                                 int nNumOfRotations, 
@@ -34,7 +34,7 @@
 * 	2. Go to the Wolf's tile.
 * 	3. Go to the Pit's tile.
 *
-* Last Modified: 04/02/2022
+* Last Modified: 19/10/2026
 * Acknowledgements: 
 *       <stdlib.h> library - https://www.tutorialspoint.com/c_standard_library/stdlib_h.htm
 *       <time.h> library - https://www.tutorialspoint.com/c_standard_library/time_h.htm
@@ -59,9 +59,13 @@ main()
 	int nStepByStepMode = 0;
 	int nHasSounds = 1;
         int nSmartMode = 1;
+        int nFrontierMode = FRONTIER_MODE_INFORMATION_GAIN;
+        int nSensingMode = SENSING_MODE_DEFERRED;
+        int nPlanningBudget = 0;
+        int nTurnLimit = RANDOM_DEFAULT_TURN_LIMIT;
 
         //Display the main menu
-	displayMainMenu(&nJumboMode, &nStepByStepMode, &nHasSounds, &nSmartMode);
+	displayMainMenu(&nJumboMode, &nStepByStepMode, &nHasSounds, &nSmartMode, &nFrontierMode, &nSensingMode, &nPlanningBudget, &nTurnLimit);
 	
 	return 0;
 }
@@ -5,7 +5,7 @@
 * 	LRRHMenu.c: Contains the functions used to display the main menu of the application, as well as it's settings
 *                       and functions used to get user input with error handling.
 *
-* Last Modified: 06/02/2022
+* Last Modified: 19/10/2026
 * Acknowledgements:
 *       Terminating Programs - https://www.tutorialspoint.com/c_standard_library/c_function_exit.htm
 *       Length of a Character Array - https://www.programiz.com/c-programming/library-function/string.h/strlen
@@ -27,11 +27,19 @@
                 (tells whether or not to play sound)
         @param   (int *)  pSmartMode is the pointer to nSmartMode
                 (tells whether or not LRRH will move intelligently or randomly)
+        @param   (int *)  pFrontierMode is the pointer to nFrontierMode
+                (tells how LRRH will pick the next tile to explore)
+        @param   (int *)  pSensingMode is the pointer to nSensingMode
+                (tells whether LRRH senses every adjacent tile or defers some of them while walking)
+        @param   (int *)  pPlanningBudget is the pointer to nPlanningBudget
+                (the number of states the path generation can check in a turn, 0 if there is no limit)
+        @param   (int *)  pTurnLimit is the pointer to nTurnLimit
+                (the number of turns random mode can take before the game is stopped, 0 if there is no limit)
 
         @return  (void) no return value
 */
 void 
-displayMainMenu (int * pJumboMode, int * pStepByStepMode, int * pHasSounds, int * pSmartMode)
+displayMainMenu (int * pJumboMode, int * pStepByStepMode, int * pHasSounds, int * pSmartMode, int * pFrontierMode, int * pSensingMode, int * pPlanningBudget, int * pTurnLimit)
 {
         //Variable used to hold the user input
 	char cChosenAction;
@@ -53,12 +61,12 @@ displayMainMenu (int * pJumboMode, int * pStepByStepMode, int * pHasSounds, int
 		case 'P':
 		case 'p':
 			//Run the game
-			runGame (*pJumboMode, *pStepByStepMode, *pHasSounds, *pSmartMode);
+			runGame (*pJumboMode, *pStepByStepMode, *pHasSounds, *pSmartMode, *pFrontierMode, *pSensingMode, *pPlanningBudget, *pTurnLimit);
 			break;
 		case 'S':
 		case 's':
 			//Open the settings
-			showSettings (pJumboMode, pStepByStepMode, pHasSounds, pSmartMode);
+			showSettings (pJumboMode, pStepByStepMode, pHasSounds, pSmartMode, pFrontierMode, pSensingMode, pPlanningBudget, pTurnLimit);
 			break;
 		case 'Q':
 		case 'q':
@@ -80,11 +88,19 @@ displayMainMenu (int * pJumboMode, int * pStepByStepMode, int * pHasSounds, int
                 (tells whether or not to play sound)
         @param   (int *)  pSmartMode is the pointer to nSmartMode
                 (tells whether or not LRRH will move intelligently or randomly)
+        @param   (int *)  pFrontierMode is the pointer to nFrontierMode
+                (tells how LRRH will pick the next tile to explore)
+        @param   (int *)  pSensingMode is the pointer to nSensingMode
+                (tells whether LRRH senses every adjacent tile or defers some of them while walking)
+        @param   (int *)  pPlanningBudget is the pointer to nPlanningBudget
+                (the number of states the path generation can check in a turn, 0 if there is no limit)
+        @param   (int *)  pTurnLimit is the pointer to nTurnLimit
+                (the number of turns random mode can take before the game is stopped, 0 if there is no limit)
         
         @return  (void) no return value
 */
 void 
-showSettings (int * pJumboMode, int * pStepByStepMode, int * pHasSounds, int * pSmartMode)
+showSettings (int * pJumboMode, int * pStepByStepMode, int * pHasSounds, int * pSmartMode, int * pFrontierMode, int * pSensingMode, int * pPlanningBudget, int * pTurnLimit)
 {
         //Variable used to hold the user input
 	char cChosenAction;
@@ -97,6 +113,10 @@ showSettings (int * pJumboMode, int * pStepByStepMode, int * pHasSounds, int * p
 		printf ("Enabled Step-By-Step Mode? (S): %c\n", getMode (*pStepByStepMode));
 		printf ("Enabled Sound Effects? (X): %c\n", getMode (*pHasSounds));
                 printf ("Enabled Smart Mode? (I): %c\n", getMode (*pSmartMode));
+                printf ("Frontier Mode? (F): %s\n", getFrontierMode (*pFrontierMode));
+                printf ("Sensing Mode? (D): %s\n", getSensingMode (*pSensingMode));
+                printf ("Planning Budget? (A): %d\n", *pPlanningBudget);
+                printf ("Random Mode Turn Limit? (T): %d\n", *pTurnLimit);
 		printf ("QUIT? (Q)\n");
 		cChosenAction = scanCharacter();
 		if (*pHasSounds)
@@ -126,10 +146,30 @@ showSettings (int * pJumboMode, int * pStepByStepMode, int * pHasSounds, int * p
 			//Enable Smart / Random Mode
 			setSmartMode (pSmartMode, *pHasSounds);	
                         break;		
+                case 'F':
+		case 'f':
+			//Change how LRRH picks the next tile to explore
+			setFrontierMode (pFrontierMode, *pHasSounds);	
+                        break;		
+                case 'D':
+		case 'd':
+			//Change when LRRH senses the tiles around her while walking
+			setSensingMode (pSensingMode, *pHasSounds);	
+                        break;		
+                case 'A':
+		case 'a':
+			//Change how many states the path generation can check in a turn
+			setPlanningBudget (pPlanningBudget, *pHasSounds);	
+                        break;		
+                case 'T':
+		case 't':
+			//Change how many turns random mode can take
+			setTurnLimit (pTurnLimit, *pHasSounds);	
+                        break;		
 		case 'Q':
 		case 'q':
 			//Quit and return to the main menu
-			displayMainMenu (pJumboMode, pStepByStepMode, pHasSounds, pSmartMode);
+			displayMainMenu (pJumboMode, pStepByStepMode, pHasSounds, pSmartMode, pFrontierMode, pSensingMode, pPlanningBudget, pTurnLimit);
 			break;
 		default:
 			printf ("\nPlease enter a valid character.\n\n\n");
@@ -292,6 +332,186 @@ setSmartMode (int * pSmartMode, int nHasSounds)
 	}
 }
 
+/* This function sets how LRRH picks the next tile to explore in smart mode
+        @param   (int *)  pFrontierMode is the pointer to nFrontierMode
+                (tells how LRRH will pick the next tile to explore)
+        @param   (int)  nHasSounds tells whether or not to play sound
+        
+        @return  (void) no return value
+*/
+void 
+setFrontierMode (int * pFrontierMode, int nHasSounds)
+{
+        //Variable used to hold the user input
+        char cTempFrontierMode;
+
+	while (1)
+	{
+		
+		displayDivider ();
+		printf ("\nType (N) to explore the nearest tile first, (I) to explore the tile where LRRH learns the most first,\n(P) to explore the tile with the shortest walk first,\n(R) to explore the tile that plays out best over many guesses of the hidden tiles first, and (Q) to quit:\n");
+		cTempFrontierMode = scanCharacter();
+		if (nHasSounds) 
+                        playAlertSound ();
+
+		if (cTempFrontierMode == 'N' || cTempFrontierMode == 'n'){
+			//Explore the nearest tile first
+			*pFrontierMode = FRONTIER_MODE_NEAREST;
+			break;
+		} else if (cTempFrontierMode == 'I' || cTempFrontierMode == 'i') {
+			//Explore the tile with the most unexplored neighbors for its distance first
+			*pFrontierMode = FRONTIER_MODE_INFORMATION_GAIN;
+			break;
+		} else if (cTempFrontierMode == 'P' || cTempFrontierMode == 'p') {
+			//Explore the tile with the shortest walk around the known pits first
+			*pFrontierMode = FRONTIER_MODE_PATH_DISTANCE;
+			break;
+		} else if (cTempFrontierMode == 'R' || cTempFrontierMode == 'r') {
+			//Explore the tile with the least actions left to finish the story over the sampled playing grids first
+			*pFrontierMode = FRONTIER_MODE_ROLLOUT;
+			break;
+		} else if (cTempFrontierMode == 'Q' || cTempFrontierMode == 'q'){
+                        //Just quit
+                        break;
+                } else 
+                        printf ("\nPlease enter a valid character.\n");
+
+	}
+}
+
+/* This function gives the name of the frontier mode
+        @param   (int)  nFrontierMode is the frontier mode chosen
+        
+        @return  (char *) the name of the frontier mode
+*/
+char * getFrontierMode (int nFrontierMode)
+{
+	if (nFrontierMode == FRONTIER_MODE_INFORMATION_GAIN) 
+                return "Information Gain";
+	else if (nFrontierMode == FRONTIER_MODE_PATH_DISTANCE) 
+                return "Path Distance";
+	else if (nFrontierMode == FRONTIER_MODE_ROLLOUT) 
+                return "Rollout";
+	else 
+                return "Nearest";
+}
+
+/* This function sets when LRRH senses the tiles around her while walking a path in smart mode
+        @param   (int *)  pSensingMode is the pointer to nSensingMode
+                (tells whether LRRH senses every adjacent tile or defers some of them while walking)
+        @param   (int)  nHasSounds tells whether or not to play sound
+        
+        @return  (void) no return value
+*/
+void 
+setSensingMode (int * pSensingMode, int nHasSounds)
+{
+        //Variable used to hold the user input
+        char cTempSensingMode;
+
+	while (1)
+	{
+		
+		displayDivider ();
+		printf ("\nType (E) to sense on every step, (D) to defer the senses that need extra rotations, and (Q) to quit:\n");
+		cTempSensingMode = scanCharacter();
+		if (nHasSounds) 
+                        playAlertSound ();
+
+		if (cTempSensingMode == 'E' || cTempSensingMode == 'e'){
+			//Sense every adjacent tile on every step
+			*pSensingMode = SENSING_MODE_EVERY_STEP;
+			break;
+		} else if (cTempSensingMode == 'D' || cTempSensingMode == 'd') {
+			//Only sense the tiles LRRH faces anyway while walking
+			*pSensingMode = SENSING_MODE_DEFERRED;
+			break;
+		} else if (cTempSensingMode == 'Q' || cTempSensingMode == 'q'){
+                        //Just quit
+                        break;
+                } else 
+                        printf ("\nPlease enter a valid character.\n");
+
+	}
+}
+
+/* This function gives the name of the sensing mode
+        @param   (int)  nSensingMode is the sensing mode chosen
+        
+        @return  (char *) the name of the sensing mode
+*/
+char * getSensingMode (int nSensingMode)
+{
+	if (nSensingMode == SENSING_MODE_DEFERRED) 
+                return "Deferred";
+	else 
+                return "Every Step";
+}
+
+/* This function sets how many states the A* path generation can check in a single turn in smart mode.
+   Once the budget runs out, LRRH walks toward the closest state checked so far instead of waiting for the full path.
+        @param   (int *)  pPlanningBudget is the pointer to nPlanningBudget
+                (the number of states the path generation can check in a turn, 0 if there is no limit)
+        @param   (int)  nHasSounds tells whether or not to play sound
+        
+        @return  (void) no return value
+*/
+void 
+setPlanningBudget (int * pPlanningBudget, int nHasSounds)
+{
+        //Variable used to hold the user input
+        int nTempPlanningBudget;
+
+	while (1)
+	{
+		
+		displayDivider ();
+		printf ("\nEnter the number of states the path generation can check in a turn (0 for no limit):\n");
+		nTempPlanningBudget = scanNumber();
+		if (nHasSounds) 
+                        playAlertSound ();
+
+		if (nTempPlanningBudget >= 0){
+			*pPlanningBudget = nTempPlanningBudget;
+			break;
+		} else 
+                        printf ("\nPlease enter a number that is at least 0.\n");
+
+	}
+}
+
+/* This function sets how many turns LRRH can take in random mode before the game is stopped.
+   It keeps a game that wanders for too long from running forever.
+        @param   (int *)  pTurnLimit is the pointer to nTurnLimit
+                (the number of turns random mode can take before the game is stopped, 0 if there is no limit)
+        @param   (int)  nHasSounds tells whether or not to play sound
+        
+        @return  (void) no return value
+*/
+void 
+setTurnLimit (int * pTurnLimit, int nHasSounds)
+{
+        //Variable used to hold the user input
+        int nTempTurnLimit;
+
+	while (1)
+	{
+		
+		displayDivider ();
+		printf ("\nEnter the number of turns LRRH can take in random mode (0 for no limit):\n");
+		nTempTurnLimit = scanNumber();
+		if (nHasSounds) 
+                        playAlertSound ();
+
+		if (nTempTurnLimit >= 0){
+			*pTurnLimit = nTempTurnLimit;
+			break;
+		} else 
+                        printf ("\nPlease enter a number that is at least 0.\n");
+
+	}
+}
+
 /* This function sets the sound mode of the application
         @param   (int)  nCurrentMode is the boolean value of the mode chosen
         
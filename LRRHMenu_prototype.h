@@ -3,7 +3,7 @@
 *
 * Description:
 * 	LRRHMenu_prototype.h: Contains the function prototypes of LRRHMenu.c
-* Last Modified: 28/01/2022
+* Last Modified: 19/10/2026
 */
 
 #include <string.h>
@@ -11,11 +11,19 @@
 void    displayMainMenu         (int * pJumboMode, 
                                 int *pStepByStepMode, 
                                 int * pHasSounds,
-                                int * pSmartMode);
+                                int * pSmartMode,
+                                int * pFrontierMode,
+                                int * pSensingMode,
+                                int * pPlanningBudget,
+                                int * pTurnLimit);
 void    showSettings            (int * pJumboMode, 
                                 int * pStepByStepMode, 
                                 int * pHasSounds,
-                                int * pSmartMode);
+                                int * pSmartMode,
+                                int * pFrontierMode,
+                                int * pSensingMode,
+                                int * pPlanningBudget,
+                                int * pTurnLimit);
 void    setStepByStepMode       (int * pStepByStepMode, 
                                 int nHasSounds);
 void    setJumboMode            (int * pJumboMode, 
@@ -23,4 +31,14 @@ void    setJumboMode            (int * pJumboMode,
 void    setSounds               (int * pHasSounds);
 void    setSmartMode            (int * pSmartMode, 
                                 int nHasSounds);
-char    getMode                 (int nCurrentMode);
\ No newline at end of file
+void    setFrontierMode         (int * pFrontierMode, 
+                                int nHasSounds);
+char    getMode                 (int nCurrentMode);
+void    setSensingMode          (int * pSensingMode, 
+                                int nHasSounds);
+char *  getFrontierMode         (int nFrontierMode);
+char *  getSensingMode          (int nSensingMode);
+void    setPlanningBudget       (int * pPlanningBudget, 
+                                int nHasSounds);
+void    setTurnLimit            (int * pTurnLimit, 
+                                int nHasSounds);
\ No newline at end of file
@@ -4,9 +4,11 @@
 * Description:
 * 	MathFunction.c: This file contains all of the general math and logic functions the application uses
 *
-* Last Modified: 04/02/2022
+* Last Modified: 19/10/2026
 * Acknowledgements: 
 *       <stdlib.h> library - https://www.tutorialspoint.com/c_standard_library/stdlib_h.htm
+*       Parallel Random Numbers: As Easy as 1, 2, 3 (Philox) - https://www.thesalmons.org/john/random123/papers/random123sc11.pdf
+*       Fast Random Integer Generation in an Interval - https://arxiv.org/abs/1805.10941
 */
 
 #include "MathFunctions_prototype.h"
@@ -46,10 +48,131 @@ getDistance (int x1, int y1, int x2, int y2)
 }
 
 
+/* This function computes one block of 4 random numbers with Philox4x32-10. The block only depends on the counter and
+   the key, so any number of any stream can be computed directly without computing the numbers before it.
+        @param   (unsigned int *)  pCounter is the pointer to the 4 words of the counter
+        @param   (unsigned int *)  pKey is the pointer to the 2 words of the key
+        @param   (unsigned int *)  pBlock is the pointer to where the 4 random numbers will be saved
+
+        @return  (void) no return value
+*/
+void
+computePhiloxBlock (unsigned int * pCounter, unsigned int * pKey, unsigned int * pBlock)
+{
+        unsigned int unWord0 = pCounter[0], unWord1 = pCounter[1], unWord2 = pCounter[2], unWord3 = pCounter[3];
+        unsigned int unKey0 = pKey[0], unKey1 = pKey[1];
+        int nRound;
+
+        for (nRound = 0; nRound < PHILOX_NUM_OF_ROUNDS; nRound++)
+        {
+                unsigned long long ullProduct0 = (unsigned long long) PHILOX_MULTIPLIER_0 * unWord0;
+                unsigned long long ullProduct1 = (unsigned long long) PHILOX_MULTIPLIER_1 * unWord2;
+
+                unWord0 = (unsigned int) (ullProduct1 >> 32) ^ unWord1 ^ unKey0;
+                unWord2 = (unsigned int) (ullProduct0 >> 32) ^ unWord3 ^ unKey1;
+                unWord1 = (unsigned int) ullProduct1;
+                unWord3 = (unsigned int) ullProduct0;
+
+                //The key changes every round
+                unKey0 += PHILOX_KEY_STEP_0;
+                unKey1 += PHILOX_KEY_STEP_1;
+        }
+
+        pBlock[0] = unWord0;
+        pBlock[1] = unWord1;
+        pBlock[2] = unWord2;
+        pBlock[3] = unWord3;
+}
+
+/* This function seeds a random number generator. The stream of numbers only depends on the seed, the board, and
+   the game, so the same game always gets the same numbers no matter which thread runs it or in what order.
+        @param   (RandomGenerator *)  pGenerator is the pointer to the random number generator
+        @param   (unsigned long long)  ullSeed is the seed shared by every game (the key of the stream)
+        @param   (unsigned int)  unBoardId is the number that tells the boards apart
+        @param   (unsigned int)  unGameId is the number that tells the games of the same board apart
+
+        @return  (void) no return value
+*/
+void
+seedRandomGenerator (RandomGenerator * pGenerator, unsigned long long ullSeed, unsigned int unBoardId, unsigned int unGameId)
+{
+        pGenerator->unarrKey[0] = (unsigned int) ullSeed;
+        pGenerator->unarrKey[1] = (unsigned int) (ullSeed >> 32);
+
+        pGenerator->unarrCounter[0] = 0;
+        pGenerator->unarrCounter[1] = unGameId;
+        pGenerator->unarrCounter[2] = unBoardId;
+        pGenerator->unarrCounter[3] = 0;
+
+        //No block has been computed yet
+        pGenerator->nBlockIndex = PHILOX_BLOCK_SIZE;
+}
+
+/* This function seeds a random number generator with a substream of another generator's game. Every substream
+   only depends on the seed, the board, the game, and its number, so it never overlaps the game's own stream or other substreams.
+        @param   (RandomGenerator *)  pGenerator is the pointer to the random number generator to seed
+        @param   (RandomGenerator *)  pParentGenerator is the pointer to the generator of the game
+        @param   (unsigned int)  unStreamId is the number of the substream (starting from 1)
+
+        @return  (void) no return value
+*/
+void
+seedRandomSubstream (RandomGenerator * pGenerator, RandomGenerator * pParentGenerator, unsigned int unStreamId)
+{
+        pGenerator->unarrKey[0] = pParentGenerator->unarrKey[0];
+        pGenerator->unarrKey[1] = pParentGenerator->unarrKey[1];
+
+        pGenerator->unarrCounter[0] = 0;
+        pGenerator->unarrCounter[1] = pParentGenerator->unarrCounter[1];
+        pGenerator->unarrCounter[2] = pParentGenerator->unarrCounter[2];
+        pGenerator->unarrCounter[3] = unStreamId;
+
+        pGenerator->nBlockIndex = PHILOX_BLOCK_SIZE;
+}
+
+/* This function gives the next 32-bit random number of a generator. A new block is computed every PHILOX_BLOCK_SIZE numbers.
+        @param   (RandomGenerator *)  pGenerator is the pointer to the random number generator
+
+        @return  (unsigned int) a random number from 0 to 4294967295
+*/
+unsigned int
+getNextRandomNumber (RandomGenerator * pGenerator)
+{
+        if (pGenerator->nBlockIndex == PHILOX_BLOCK_SIZE){
+                computePhiloxBlock (pGenerator->unarrCounter, pGenerator->unarrKey, pGenerator->unarrBlock);
+                pGenerator->unarrCounter[0]++;
+                pGenerator->nBlockIndex = 0;
+        }
+
+        return pGenerator->unarrBlock[pGenerator->nBlockIndex++];
+}
+
+/* This function generates a random number between a minimum and maximum value (both included).
+   Every number has the exact same chance: the random number is multiplied by the size of the range and the top 32 bits
+   are taken, and the few numbers that would make some results more likely than others are thrown away and drawn again.
+        @param   (RandomGenerator *)  pGenerator is the pointer to the random number generator of the game
+        @param   (int)  nMin is the minimum value
+        @param   (int)  nMax is the maximum value
+
+        @return  (int) a random number from nMin to nMax
+*/
 int 
-generateRandomNumber (int nMin, int nMax)
+generateRandomNumber (RandomGenerator * pGenerator, int nMin, int nMax)
 {
-        int nRange = nMax - nMin + 1;
+        unsigned int unRange = (unsigned int) (nMax - nMin) + 1;
+        unsigned long long ullProduct = (unsigned long long) getNextRandomNumber (pGenerator) * unRange;
+        unsigned int unLowBits = (unsigned int) ullProduct;
+
+        //Only numbers whose low bits land under 2^32 mod range can be biased, so the division is rarely needed
+        if (unLowBits < unRange){
+                unsigned int unThreshold = (0u - unRange) % unRange;
+
+                while (unLowBits < unThreshold)
+                {
+                        ullProduct = (unsigned long long) getNextRandomNumber (pGenerator) * unRange;
+                        unLowBits = (unsigned int) ullProduct;
+                }
+        }
 
-        return rand() % nRange + nMin;
+        return (int) (ullProduct >> 32) + nMin;
 }
\ No newline at end of file
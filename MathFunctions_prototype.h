@@ -4,9 +4,33 @@
 * Description:
 * 	MathFunctions_prototype.h: Contains the function prototypes of MathFunctions.c
 *
-* Last Modified: 28/01/2022
+* Last Modified: 19/10/2026
 */
 
+//Constants of Philox4x32-10
+#define PHILOX_NUM_OF_ROUNDS 10
+#define PHILOX_BLOCK_SIZE 4
+#define PHILOX_MULTIPLIER_0 0xD2511F53u
+#define PHILOX_MULTIPLIER_1 0xCD9E8D57u
+#define PHILOX_KEY_STEP_0 0x9E3779B9u
+#define PHILOX_KEY_STEP_1 0xBB67AE85u
+
+//A counter-based random number generator (Philox4x32-10) owned by a single game.
+//The Nth number of a game is computed from (seed, board, game, N) only, so games never depend on each other.
+typedef struct
+{
+  //The seed
+  unsigned int unarrKey[2];
+
+  //Block number, game, board, and the substream (0 for the game's own stream)
+  unsigned int unarrCounter[4];
+
+  //The last block computed, and the index of the next number to take from it
+  unsigned int unarrBlock[PHILOX_BLOCK_SIZE];
+  int nBlockIndex;
+
+} RandomGenerator;
+
 int     isLocationValid         (int nXLocation, 
                                 int nYLocation, 
                                 int nGridSize);
@@ -14,5 +38,17 @@ int     getDistance             (int x1,
                                 int y1, 
                                 int x2, 
                                 int y2);
-int     generateRandomNumber    (int nMin, 
+void    computePhiloxBlock      (unsigned int * pCounter, 
+                                unsigned int * pKey, 
+                                unsigned int * pBlock);
+void    seedRandomGenerator     (RandomGenerator * pGenerator, 
+                                unsigned long long ullSeed, 
+                                unsigned int unBoardId, 
+                                unsigned int unGameId);
+void    seedRandomSubstream     (RandomGenerator * pGenerator, 
+                                RandomGenerator * pParentGenerator, 
+                                unsigned int unStreamId);
+unsigned int    getNextRandomNumber     (RandomGenerator * pGenerator);
+int     generateRandomNumber    (RandomGenerator * pGenerator, 
+                                int nMin, 
                                 int nMax);
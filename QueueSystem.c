@@ -5,7 +5,7 @@
 * 	QueueSystem.c: A queueing system to be used for the Machine Project. 
 *       An Array is used to be able to dynamically store objects.
 *
-* Last Modified: 04/02/2022
+* Last Modified: 19/10/2026
 * Acknowledgements: 
 *	Pointers and 2D arrays - https://overiq.com/c-programming-101/pointers-and-2-d-arrays/
 *       Dynamic Arrays - https://stackoverflow.com/questions/3536153/c-dynamically-growing-array
@@ -67,12 +67,12 @@ dequeue (Queue *pQueue)
 		
 
                 //Offset the array to make the elements in the back to the front.
-		int i = 0;
-		do
+                //The last element has nothing behind it, so it is not read past the end of the array.
+		int i;
+		for (i = 0; i < pQueue->nCount - 1; i++)
                 {
 		        pQueue->pArray[i] = pQueue->pArray[i + 1];
-                        i++;
-		} while (i < pQueue->nCount);
+		}
 
                 //decrease the queue's capacity
 		pQueue->nCount--;
@@ -107,6 +107,23 @@ reverseQueue (Queue *pQueue)
         }
 }
 
+/* This function replaces the elements of the queue with a copy of the given elements
+        @param   (Queue *)  pQueue is the pointer to the selected queue
+        @param   (int *)  pElements is the pointer to the elements, from the front of the queue to its back
+        @param   (int)  nNumOfElements is the number of elements
+     
+        @return  (void) no return value
+*/
+void 
+setQueueElements (Queue * pQueue, int * pElements, int nNumOfElements)
+{
+        //Keep room for at least 1 integer, like a newly initialized queue
+        pQueue->pArray = realloc (pQueue->pArray, (nNumOfElements > 0 ? nNumOfElements : 1) * sizeof(int));
+        pQueue->nCount = nNumOfElements;
+
+        memcpy (pQueue->pArray, pElements, nNumOfElements * sizeof(int));
+}
+
 /* This function clears the queue and its elements
         @param   (Queue *)  pQueue is the pointer to the selected queue
      
@@ -212,30 +229,32 @@ void
 removeWalkedCoordinatesFromQueue (Queue * pXQueue, Queue * pYQueue, int * pWalkedTiles, int nGridSize)
 {
 	int i;
-	int nNumOfWalkedTiles = 0;
-	int narrWalkedTilesArray[pXQueue->nCount];
+	int nNumOfKeptTiles = 0;
 	
         //Loop through the queues
 	for (i = 0; i < pXQueue->nCount; i++)
 	{	
-                /*Check if the value of the location at the walked tiles array is not equal to 0.
-                  If so, that means that the location has already been explored.
-                  If so, add the index of that location and increment the number of walked tiles.
-                  it has not been explored and should not be removed.
+                /*Check if the value of the location at the walked tiles array is equal to 0.
+                  If so, it has not been explored and should be kept. It is moved right after the other kept locations.
+                  Else, the location has already been explored and is left out.
+                  (Removing the locations one by one would shift the indexes of the locations after them)
                 */	
-		if (*(pWalkedTiles + pXQueue->pArray[i] * nGridSize + pYQueue->pArray[i]) != 0)
+		if (*(pWalkedTiles + pXQueue->pArray[i] * nGridSize + pYQueue->pArray[i]) == 0)
 		{			
-			narrWalkedTilesArray[nNumOfWalkedTiles] = i;
-			nNumOfWalkedTiles++;
+			pXQueue->pArray[nNumOfKeptTiles] = pXQueue->pArray[i];
+			pYQueue->pArray[nNumOfKeptTiles] = pYQueue->pArray[i];
+			nNumOfKeptTiles++;
 		}
 		
 	}
 	
-        //Seperate the checking and removal of walked tiles in different loops.
-        //So to prevent changing the values while looping in the X and Y queues.
-	for (i = 0; i < nNumOfWalkedTiles; i++)
-	{
-		removeLocationFromQueues(narrWalkedTilesArray[i], pXQueue, pYQueue);				
+        //Only the kept locations remain in the queues
+	if (nNumOfKeptTiles != pXQueue->nCount){
+		pXQueue->nCount = nNumOfKeptTiles;
+		pYQueue->nCount = nNumOfKeptTiles;
+
+		pXQueue->pArray = realloc (pXQueue->pArray, nNumOfKeptTiles * sizeof(int));
+		pYQueue->pArray = realloc (pYQueue->pArray, nNumOfKeptTiles * sizeof(int));
 	}
 }
 
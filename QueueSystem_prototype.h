@@ -4,10 +4,12 @@
 * Description:
 * 	QueueSystem_prototype.h: Contains the function prototypes of QueueSystem.c
 *
-* Last Modified: 04/02/2022
+* Last Modified: 19/10/2026
 */
 
 
+#include <string.h>
+
 typedef struct 
 {
   int * pArray;
@@ -20,6 +22,9 @@ void    enqueue                                 (Queue * pQueue,
                                                 int element);
 int     dequeue                                 (Queue * pQueue);
 void    reverseQueue                            (Queue * pQueue);
+void    setQueueElements                        (Queue * pQueue, 
+                                                int * pElements, 
+                                                int nNumOfElements);
 void    clearQueue                              (Queue * pQueue);
 
 void    swapCoordinates                         (int * pX1, 
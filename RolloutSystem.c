@@ -0,0 +1,529 @@
+/*
+* Programmed By: Aaron Gabrielle Dichoso
+*
+* Description:
+* 	RolloutSystem.c: A rollout system to be used for the Machine Project.
+*       Chooses the next tile LRRH explores in rollout mode. The hidden tiles are filled in many times with pits and
+*       the elements LRRH has not sensed yet. On each of these sampled playing grids, LRRH starts from every candidate
+*       tile, keeps exploring the closest tile she has not sensed around until she has found everything she needs,
+*       then walks to her objectives and to granny's house. The candidate with the least number of actions on average
+*       is explored first. The rollouts are split across threads, and the random numbers of each rollout only depend
+*       on its number, so the choice is the same no matter how many threads are used.
+*
+* Last Modified: 19/10/2026
+* Acknowledgements:
+*       Monte Carlo tree search (rollouts) - https://en.wikipedia.org/wiki/Monte_Carlo_tree_search
+*       Determinization of hidden information - https://en.wikipedia.org/wiki/Information_set_(game_theory)
+*       Rule of succession - https://en.wikipedia.org/wiki/Rule_of_succession
+*/
+
+#include "RolloutSystem_prototype.h"
+
+/* This function initializes a rollout planner, and allocates the workers it keeps for the whole game
+        @param   (RolloutPlanner *)  pPlanner is the pointer to Planner
+        @param   (RandomGenerator *)  pGenerator is the pointer to the random numbers of the game (the rollouts use its substreams)
+        @param   (int)  nNumOfRollouts is the number of sampled playing grids each choice is made on
+        @param   (int)  nNumOfThreads is the number of threads playing the rollouts
+
+        @return  (void) no return value
+*/
+void
+initRolloutPlanner (RolloutPlanner * pPlanner,
+                        RandomGenerator * pGenerator,
+                        int nNumOfRollouts,
+                        int nNumOfThreads)
+{
+        int i;
+
+        pPlanner->Model.pGenerator = pGenerator;
+        pPlanner->nNumOfRollouts = nNumOfRollouts;
+        pPlanner->nNumOfThreads = nNumOfThreads;
+        pPlanner->unNumOfChoices = 0;
+
+        pPlanner->pWorkers = malloc (nNumOfThreads * sizeof (RolloutWorker));
+
+        //No search has been done yet, so no tile has the stamp of a search
+        for (i = 0; i < nNumOfThreads; i++)
+        {
+                memset (pPlanner->pWorkers[i].narrSearchStamps, 0, sizeof (pPlanner->pWorkers[i].narrSearchStamps));
+                pPlanner->pWorkers[i].nSearchStamp = 0;
+        }
+}
+
+/* This function frees the memory used by a rollout planner
+        @param   (RolloutPlanner *)  pPlanner is the pointer to Planner
+
+        @return  (void) no return value
+*/
+void
+clearRolloutPlanner (RolloutPlanner * pPlanner)
+{
+        free (pPlanner->pWorkers);
+        pPlanner->pWorkers = NULL;
+}
+
+/* This function gives the tiles above, below, to the left and to the right of a tile, if they are inside the playing grid
+        @param   (int)  nTile is the tile (index X * nGridSize + Y)
+        @param   (int)  nGridSize is the size of the playing grid
+        @param   (int *)  pNeighbors is the pointer to where the tiles will be saved (NUM_OF_DIRECTIONS tiles)
+
+        @return  (int) the number of tiles saved
+*/
+int
+getRolloutNeighbors (int nTile, int nGridSize, int * pNeighbors)
+{
+        int nXLocation = nTile / nGridSize;
+        int nYLocation = nTile % nGridSize;
+        int nNumOfNeighbors = 0;
+
+        if (nXLocation > 0)
+                pNeighbors[nNumOfNeighbors++] = nTile - nGridSize;
+        if (nXLocation < nGridSize - 1)
+                pNeighbors[nNumOfNeighbors++] = nTile + nGridSize;
+        if (nYLocation > 0)
+                pNeighbors[nNumOfNeighbors++] = nTile - 1;
+        if (nYLocation < nGridSize - 1)
+                pNeighbors[nNumOfNeighbors++] = nTile + 1;
+
+        return nNumOfNeighbors;
+}
+
+/* This function does a breadth first search on the worker's playing grid, and stops at the closest sensed tile with one of the target values.
+   LRRH can only walk on the tiles she has sensed with a positive value, except for the wolf and granny's house,
+   which she only walks into as a target.
+        @param   (RolloutWorker *)  pWorker is the pointer to the worker (its playing grid and sensed tiles have to be filled in)
+        @param   (int)  nStartTile is the tile the search starts from (index X * nGridSize + Y)
+        @param   (int)  nTargetValue has bit (1 << value) set for each sense value to look for, and ROLLOUT_TARGET_FRONTIER
+                to also stop at a tile next to one that has not been sensed (0 to search every reachable tile)
+        @param   (int *)  pTargetTile is the pointer to where the tile that was found will be saved
+
+        @return  (int) the number of moves to the closest target tile, -1 if none can be reached
+*/
+int
+searchRolloutDistance (RolloutWorker * pWorker,
+                        int nStartTile,
+                        int nTargetValue,
+                        int * pTargetTile)
+{
+        int nGridSize = pWorker->pModel->nGridSize;
+        int narrNeighbors[NUM_OF_DIRECTIONS];
+        int nFront = 0;
+        int nBack = 0;
+        int i;
+
+        int nStamp = ++pWorker->nSearchStamp;
+
+        pWorker->narrSearchStamps[nStartTile] = nStamp;
+        pWorker->narrDistances[nStartTile] = 0;
+        pWorker->narrSearchQueue[nBack++] = nStartTile;
+
+        while (nFront < nBack)
+        {
+                int nTile = pWorker->narrSearchQueue[nFront++];
+                int nValue = pWorker->scarrSampledTiles[nTile];
+
+                if (nValue > UNEXPLORED_TILE_VALUE && ((nTargetValue >> nValue) & 1)){
+                        *pTargetTile = nTile;
+                        return pWorker->narrDistances[nTile];
+                }
+
+                //Only the start tile is left even if LRRH could not walk on it
+                if (nTile != nStartTile && (nValue <= UNEXPLORED_TILE_VALUE || nValue == WOLF_TILE_VALUE || nValue == GRANDMA_TILE_VALUE))
+                        continue;
+
+                int nNumOfNeighbors = getRolloutNeighbors (nTile, nGridSize, narrNeighbors);
+
+                for (i = 0; i < nNumOfNeighbors; i++)
+                {
+                        int nNextTile = narrNeighbors[i];
+
+                        if (!pWorker->ucarrSensedTiles[nNextTile]){
+                                if (nTargetValue & ROLLOUT_TARGET_FRONTIER){
+                                        *pTargetTile = nTile;
+                                        return pWorker->narrDistances[nTile];
+                                }
+                        } else if (pWorker->narrSearchStamps[nNextTile] != nStamp){
+                                pWorker->narrSearchStamps[nNextTile] = nStamp;
+                                pWorker->narrDistances[nNextTile] = pWorker->narrDistances[nTile] + 1;
+                                pWorker->narrSearchQueue[nBack++] = nNextTile;
+                        }
+                }
+        }
+
+        return -1;
+}
+
+/* This function makes LRRH sense the tiles around her that she has not sensed yet in the worker's playing grid
+        @param   (RolloutWorker *)  pWorker is the pointer to the worker
+        @param   (int)  nTile is the tile LRRH is on (index X * nGridSize + Y)
+        @param   (int *)  pUnsensedTargets is the pointer to the bits of the elements LRRH still has to find
+                (the bit of each element she senses is cleared)
+
+        @return  (int) the number of tiles sensed
+*/
+int
+senseRolloutNeighbors (RolloutWorker * pWorker, int nTile, int * pUnsensedTargets)
+{
+        int narrNeighbors[NUM_OF_DIRECTIONS];
+        int nNumOfNeighbors = getRolloutNeighbors (nTile, pWorker->pModel->nGridSize, narrNeighbors);
+        int nNumOfSenses = 0;
+        int i;
+
+        for (i = 0; i < nNumOfNeighbors; i++)
+        {
+                int nNextTile = narrNeighbors[i];
+                int nValue = pWorker->scarrSampledTiles[nNextTile];
+
+                if (!pWorker->ucarrSensedTiles[nNextTile]){
+                        pWorker->ucarrSensedTiles[nNextTile] = 1;
+                        nNumOfSenses++;
+
+                        if (nValue > UNEXPLORED_TILE_VALUE)
+                                *pUnsensedTargets &= ~(1 << nValue);
+                }
+        }
+
+        return nNumOfSenses;
+}
+
+/* This function fills in the hidden tiles of a playing grid. Each hidden tile is a pit by the chance in the model,
+   then each element LRRH has not sensed yet is put on a hidden tile that does not have an element yet.
+        @param   (RolloutModel *)  pModel is the pointer to what LRRH knows
+        @param   (RandomGenerator *)  pGenerator is the pointer to the random numbers of the rollout
+        @param   (signed char *)  pTiles is the pointer to where the sampled playing grid will be saved
+
+        @return  (void) no return value
+*/
+void
+sampleRolloutTiles (RolloutModel * pModel,
+                        RandomGenerator * pGenerator,
+                        signed char * pTiles)
+{
+        int i, j;
+
+        memcpy (pTiles, pModel->scarrKnownTiles, pModel->nGridSize * pModel->nGridSize);
+
+        for (i = 0; i < pModel->nNumOfHiddenTiles; i++)
+        {
+                int nIsPit = generateRandomNumber (pGenerator, 1, pModel->nPitChanceDenominator) <= pModel->nPitChanceNumerator;
+
+                pTiles[pModel->narrHiddenTiles[i]] = nIsPit ? UNWALKABLE_TILE_VALUE : WALKABLE_TILE_VALUE;
+        }
+
+        for (i = 0; i < pModel->nNumOfMissingElements; i++)
+        {
+                int nElement = pModel->narrMissingElements[i];
+                int * pPlaces = pModel->narrHiddenTiles;
+                int nNumOfPlaces = pModel->nNumOfHiddenTiles;
+
+                //Granny's house can only be on the ring once the woodsman has given his hint
+                if (nElement == GRANDMA_TILE_VALUE && pModel->nNumOfGrannyTiles > 0){
+                        pPlaces = pModel->narrGrannyTiles;
+                        nNumOfPlaces = pModel->nNumOfGrannyTiles;
+                }
+
+                //Give up on an element after as many tries as there are places, in case every place already has one
+                for (j = 0; j < nNumOfPlaces; j++)
+                {
+                        int nTile = pPlaces[generateRandomNumber (pGenerator, 0, nNumOfPlaces - 1)];
+
+                        if (pTiles[nTile] <= WALKABLE_TILE_VALUE){
+                                pTiles[nTile] = nElement;
+                                break;
+                        }
+                }
+        }
+}
+
+/* This function counts the actions LRRH needs on the worker's sampled playing grid to finish her story from a tile.
+   She keeps going to the closest tile next to one she has not sensed and senses around it, like the nearest frontier mode,
+   until she has found granny's house and every objective she still needs. Then she goes to the closest objective she still needs,
+   then the closest one from there, and so on, and then to granny's house. Each movement is one action, each sense is
+   ROLLOUT_SENSE_COST actions, and each walk to another tile while exploring needs ROLLOUT_TURN_COST more.
+        @param   (RolloutWorker *)  pWorker is the pointer to the worker (its sampled playing grid has to be filled in)
+        @param   (int)  nStartTile is the tile LRRH starts from (index X * nGridSize + Y)
+
+        @return  (int) the number of actions, or ROLLOUT_UNREACHABLE_COST_PER_TILE for every tile if LRRH cannot finish her story
+*/
+int
+computeRolloutCost (RolloutWorker * pWorker, int nStartTile)
+{
+        RolloutModel * pModel = pWorker->pModel;
+        int nUnreachableCost = ROLLOUT_UNREACHABLE_COST_PER_TILE * pModel->nGridSize * pModel->nGridSize;
+        int nUnsensedTargets = pModel->nUnsensedTargets;
+        int nNeededObjectives = pModel->nNeededObjectives;
+        int nTile = nStartTile;
+        int nCost = 0;
+
+        memcpy (pWorker->ucarrSensedTiles, pModel->ucarrKnownSensedTiles, pModel->nGridSize * pModel->nGridSize);
+
+        //Explore until everything LRRH needs has been found
+        nCost += ROLLOUT_SENSE_COST * senseRolloutNeighbors (pWorker, nTile, &nUnsensedTargets);
+
+        while (nUnsensedTargets)
+        {
+                int nDistance = searchRolloutDistance (pWorker, nTile, ROLLOUT_TARGET_FRONTIER, &nTile);
+
+                if (nDistance == -1)
+                        return nUnreachableCost;
+
+                nCost += nDistance + ROLLOUT_SENSE_COST * senseRolloutNeighbors (pWorker, nTile, &nUnsensedTargets);
+
+                if (nDistance > 0)
+                        nCost += ROLLOUT_TURN_COST;
+        }
+
+        //Go to the closest objective each time, then to granny's house once every objective is done
+        while (1)
+        {
+                int nTargetValue = nNeededObjectives ? nNeededObjectives : 1 << GRANDMA_TILE_VALUE;
+                int nDistance = searchRolloutDistance (pWorker, nTile, nTargetValue, &nTile);
+
+                if (nDistance == -1)
+                        return nUnreachableCost;
+
+                nCost += nDistance;
+
+                if (!nNeededObjectives)
+                        return nCost;
+
+                nNeededObjectives &= ~(1 << pWorker->scarrSampledTiles[nTile]);
+        }
+}
+
+/* This function plays the worker's range of rollouts. Each rollout samples a playing grid with its own substream,
+   and every candidate is played on the same sampled playing grid so that they are compared fairly.
+        @param   (RolloutWorker *)  pWorker is the pointer to the worker
+
+        @return  (void) no return value
+*/
+void
+playRollouts (RolloutWorker * pWorker)
+{
+        RolloutModel * pModel = pWorker->pModel;
+        RandomGenerator Generator;
+        int i, j;
+
+        for (j = 0; j < pModel->nNumOfCandidates; j++)
+        {
+                pWorker->llarrCosts[j] = 0;
+        }
+
+        for (i = pWorker->nFirstRollout; i < pWorker->nFirstRollout + pWorker->nNumOfRollouts; i++)
+        {
+                seedRandomSubstream (&Generator, pModel->pGenerator, pModel->unFirstStreamId + i);
+                sampleRolloutTiles (pModel, &Generator, pWorker->scarrSampledTiles);
+
+                for (j = 0; j < pModel->nNumOfCandidates; j++)
+                {
+                        pWorker->llarrCosts[j] += computeRolloutCost (pWorker, pModel->narrCandidateTiles[j]);
+                }
+        }
+}
+
+/* This function is run by each worker thread of a choice
+        @param   (LPVOID)  pParameter is the pointer to the worker
+
+        @return  (DWORD) always returns 0
+*/
+DWORD WINAPI
+runRolloutWorker (LPVOID pParameter)
+{
+        playRollouts ((RolloutWorker *) pParameter);
+
+        return 0;
+}
+
+/* This function chooses the next tile LRRH explores from the tiles at the front of the queue (after orderFrontierQueue),
+   and moves it to the front of the queue. Each candidate is scored by the number of moves LRRH needs to get there
+   on the tiles she knows, plus the average number of actions she needs from there to finish her story on the sampled playing grids.
+   The tile at the front of the queue is kept unless another candidate is better by more than ROLLOUT_MIN_GAIN actions on average,
+   and if the scores are the same, the tile closer to the front of the queue is kept first.
+        @param   (RolloutPlanner *)  pPlanner is the pointer to Planner
+        @param   (GameState *)  pGame is the pointer to Game (LRRH, her items, what she knows, and her queues)
+
+        @return  (void) no return value
+*/
+void
+chooseRolloutFrontierTile (RolloutPlanner * pPlanner, GameState * pGame)
+{
+        RolloutModel * pModel = &pPlanner->Model;
+        KnowledgeMap * pKnowledge = pGame->pKnowledge;
+        int nGridSize = pGame->nGridSize;
+        int nNumOfSensedTiles = 0;
+        int nNumOfPits = 0;
+        int i;
+
+        if (pGame->XGridQueue.nCount <= 1)
+                return;
+
+        //Copy what LRRH knows, with granny and the wolf always positive since the rollouts decide on their own when to walk on them
+        pModel->nGridSize = nGridSize;
+        pModel->nNumOfHiddenTiles = 0;
+        pModel->nNumOfGrannyTiles = 0;
+
+        for (i = 0; i < nGridSize * nGridSize; i++)
+        {
+                int nSenseValue = pGame->pSensedTiles[i];
+
+                if (abs (nSenseValue) == GRANDMA_TILE_VALUE || abs (nSenseValue) == WOLF_TILE_VALUE)
+                        nSenseValue = abs (nSenseValue);
+                else if (nSenseValue < UNEXPLORED_TILE_VALUE)
+                        nSenseValue = UNWALKABLE_TILE_VALUE;
+
+                pModel->scarrKnownTiles[i] = nSenseValue;
+                pModel->ucarrKnownSensedTiles[i] = nSenseValue != UNEXPLORED_TILE_VALUE;
+
+                if (nSenseValue == UNEXPLORED_TILE_VALUE){
+                        pModel->narrHiddenTiles[pModel->nNumOfHiddenTiles++] = i;
+
+                        if (pKnowledge->nWoodsmanDistance != -1 && getBitboardTile (&pKnowledge->GrannyRingPlane, i / nGridSize, i % nGridSize))
+                                pModel->narrGrannyTiles[pModel->nNumOfGrannyTiles++] = i;
+                } else {
+                        nNumOfSensedTiles++;
+                        nNumOfPits += nSenseValue == UNWALKABLE_TILE_VALUE;
+                }
+        }
+
+        pModel->nPitChanceNumerator = nNumOfPits + 1;
+        pModel->nPitChanceDenominator = nNumOfSensedTiles + 2;
+
+        pModel->nNeededObjectives = (pGame->nHasFlower ? 0 : 1 << FLOWER_TILE_VALUE) |
+                                        (pGame->nVisitedWoodsman ? 0 : 1 << WOODSMAN_TILE_VALUE) |
+                                        (pGame->nHasBread ? 0 : 1 << BAKERY_TILE_VALUE);
+        pModel->nUnsensedTargets = 0;
+
+        //Granny's house is placed first, as it has the fewest places it can be on
+        pModel->nNumOfMissingElements = 0;
+
+        if (countBitboardTiles (&pKnowledge->GrandmaPlane) == 0)
+                pModel->narrMissingElements[pModel->nNumOfMissingElements++] = GRANDMA_TILE_VALUE;
+        if (countBitboardTiles (&pKnowledge->WoodsmanPlane) == 0 && !pGame->nVisitedWoodsman)
+                pModel->narrMissingElements[pModel->nNumOfMissingElements++] = WOODSMAN_TILE_VALUE;
+        if (countBitboardTiles (&pKnowledge->WolfPlane) == 0)
+                pModel->narrMissingElements[pModel->nNumOfMissingElements++] = WOLF_TILE_VALUE;
+        if (countBitboardTiles (&pKnowledge->FlowerPlane) == 0 && !pGame->nHasFlower)
+                pModel->narrMissingElements[pModel->nNumOfMissingElements++] = FLOWER_TILE_VALUE;
+        if (countBitboardTiles (&pKnowledge->BakeryPlane) == 0 && !pGame->nHasBread)
+                pModel->narrMissingElements[pModel->nNumOfMissingElements++] = BAKERY_TILE_VALUE;
+
+        //LRRH has to find every missing element she needs before going to it (the wolf is only in her way)
+        for (i = 0; i < pModel->nNumOfMissingElements; i++)
+        {
+                if (pModel->narrMissingElements[i] != WOLF_TILE_VALUE)
+                        pModel->nUnsensedTargets |= 1 << pModel->narrMissingElements[i];
+        }
+
+        /*The candidates are the tiles at the front of the queue that LRRH can get to on the tiles she knows,
+          and that are at most ROLLOUT_DISTANCE_SLACK moves farther than the closest of them*/
+        RolloutWorker * pFirstWorker = &pPlanner->pWorkers[0];
+        int narrQueueDistances[ROLLOUT_NUM_OF_CANDIDATES];
+        int narrCandidateIndexes[ROLLOUT_NUM_OF_CANDIDATES];
+        int narrCandidateDistances[ROLLOUT_NUM_OF_CANDIDATES];
+        int nNumOfQueueTiles = pGame->XGridQueue.nCount < ROLLOUT_NUM_OF_CANDIDATES ? pGame->XGridQueue.nCount : ROLLOUT_NUM_OF_CANDIDATES;
+        int nClosestDistance = -1;
+        int nTargetTile;
+
+        pFirstWorker->pModel = pModel;
+        memcpy (pFirstWorker->scarrSampledTiles, pModel->scarrKnownTiles, nGridSize * nGridSize);
+        memcpy (pFirstWorker->ucarrSensedTiles, pModel->ucarrKnownSensedTiles, nGridSize * nGridSize);
+        searchRolloutDistance (pFirstWorker, pGame->nLRRHXLocation * nGridSize + pGame->nLRRHYLocation, 0, &nTargetTile);
+
+        for (i = 0; i < nNumOfQueueTiles; i++)
+        {
+                int nTile = pGame->XGridQueue.pArray[i] * nGridSize + pGame->YGridQueue.pArray[i];
+
+                narrQueueDistances[i] = pFirstWorker->narrSearchStamps[nTile] == pFirstWorker->nSearchStamp ? pFirstWorker->narrDistances[nTile] : -1;
+
+                if (narrQueueDistances[i] != -1 && (nClosestDistance == -1 || narrQueueDistances[i] < nClosestDistance))
+                        nClosestDistance = narrQueueDistances[i];
+        }
+
+        pModel->nNumOfCandidates = 0;
+
+        for (i = 0; i < nNumOfQueueTiles; i++)
+        {
+                if (narrQueueDistances[i] != -1 && narrQueueDistances[i] <= nClosestDistance + ROLLOUT_DISTANCE_SLACK){
+                        narrCandidateIndexes[pModel->nNumOfCandidates] = i;
+                        narrCandidateDistances[pModel->nNumOfCandidates] = narrQueueDistances[i];
+                        pModel->narrCandidateTiles[pModel->nNumOfCandidates] = pGame->XGridQueue.pArray[i] * nGridSize + pGame->YGridQueue.pArray[i];
+                        pModel->nNumOfCandidates++;
+                }
+        }
+
+        //There is nothing to choose between (Ex: only one tile is the closest)
+        if (pModel->nNumOfCandidates <= 1)
+                return;
+
+        //Every choice has its own substreams, one for each rollout
+        pModel->unFirstStreamId = pPlanner->unNumOfChoices * pPlanner->nNumOfRollouts + 1;
+        pPlanner->unNumOfChoices++;
+
+        //Give each thread its own range of rollouts
+        int nNumOfAssignedRollouts = 0;
+
+        for (i = 0; i < pPlanner->nNumOfThreads; i++)
+        {
+                RolloutWorker * pWorker = &pPlanner->pWorkers[i];
+
+                pWorker->pModel = pModel;
+                pWorker->nFirstRollout = nNumOfAssignedRollouts;
+                pWorker->nNumOfRollouts = (pPlanner->nNumOfRollouts - nNumOfAssignedRollouts) / (pPlanner->nNumOfThreads - i);
+                nNumOfAssignedRollouts += pWorker->nNumOfRollouts;
+
+                //If the thread could not be made, the rollouts are played by the calling thread later on
+                pWorker->hWorkerThread = CreateThread (NULL, 0, runRolloutWorker, pWorker, 0, NULL);
+        }
+
+        long long llarrCosts[ROLLOUT_NUM_OF_CANDIDATES] = {0};
+        int j;
+
+        for (i = 0; i < pPlanner->nNumOfThreads; i++)
+        {
+                if (pPlanner->pWorkers[i].hWorkerThread != NULL){
+                        WaitForSingleObject (pPlanner->pWorkers[i].hWorkerThread, INFINITE);
+                        CloseHandle (pPlanner->pWorkers[i].hWorkerThread);
+                } else
+                        playRollouts (&pPlanner->pWorkers[i]);
+
+                for (j = 0; j < pModel->nNumOfCandidates; j++)
+                {
+                        llarrCosts[j] += pPlanner->pWorkers[i].llarrCosts[j];
+                }
+        }
+
+        //Every candidate was played the same number of times, so the totals can be compared instead of the averages
+        int nBestCandidate = 0;
+        long long llBestCost = LLONG_MAX;
+
+        for (i = 0; i < pModel->nNumOfCandidates; i++)
+        {
+                long long llCost = (long long) narrCandidateDistances[i] * pPlanner->nNumOfRollouts + llarrCosts[i];
+
+                //The rollouts are only a guess of the hidden tiles, so only move away from the front tile if it is clearly worse
+                if (narrCandidateIndexes[i] == 0)
+                        llCost -= (long long) ROLLOUT_MIN_GAIN * pPlanner->nNumOfRollouts;
+
+                if (llCost < llBestCost){
+                        nBestCandidate = i;
+                        llBestCost = llCost;
+                }
+        }
+
+        //Move the best candidate to the front, and keep the order of the tiles before it
+        int nBestIndex = narrCandidateIndexes[nBestCandidate];
+
+        if (nBestIndex > 0){
+                int nBestXCoord = pGame->XGridQueue.pArray[nBestIndex];
+                int nBestYCoord = pGame->YGridQueue.pArray[nBestIndex];
+
+                for (i = nBestIndex; i > 0; i--)
+                {
+                        pGame->XGridQueue.pArray[i] = pGame->XGridQueue.pArray[i - 1];
+                        pGame->YGridQueue.pArray[i] = pGame->YGridQueue.pArray[i - 1];
+                }
+
+                pGame->XGridQueue.pArray[0] = nBestXCoord;
+                pGame->YGridQueue.pArray[0] = nBestYCoord;
+        }
+}
@@ -0,0 +1,132 @@
+/*
+* Programmed By: Aaron Gabrielle Dichoso
+*
+* Description:
+* 	RolloutSystem_prototype.h: Contains the function prototypes of RolloutSystem.c
+*
+* Last Modified: 19/10/2026
+*/
+
+//Number of tiles at the front of the queue the rollouts choose from
+#define ROLLOUT_NUM_OF_CANDIDATES 8
+
+//Number of moves a candidate can be farther than the closest one (0 to only choose between the closest ones, 
+//as going farther makes LRRH go back and forth across the grid)
+#define ROLLOUT_DISTANCE_SLACK 0
+
+//Number of actions the tile at the front of the queue has to lose by on average before another candidate is chosen
+#define ROLLOUT_MIN_GAIN 3
+
+//Number of actions counted for each sense (LRRH usually rotates to face the tile first), and for each turn between two walks
+#define ROLLOUT_SENSE_COST 2
+#define ROLLOUT_TURN_COST 1
+
+//Number of sampled playing grids each choice is made on, and the number of threads playing them
+#define ROLLOUT_DEFAULT_NUM_OF_ROLLOUTS 64
+#define ROLLOUT_DEFAULT_NUM_OF_THREADS 4
+
+//Number of actions counted for every tile of the grid when LRRH cannot finish her story in a sampled playing grid
+#define ROLLOUT_UNREACHABLE_COST_PER_TILE 4
+
+//Target of a search that stops at the closest tile next to a tile LRRH has not sensed yet (no element has this sense value)
+#define ROLLOUT_TARGET_FRONTIER (1 << UNEXPLORED_TILE_VALUE)
+
+//What LRRH knows when the rollouts start, shared by every worker and only read by them
+typedef struct
+{
+  //The sense value of every tile (index X * nGridSize + Y), with granny and the wolf always positive, and which of them are sensed
+  signed char scarrKnownTiles[BITBOARD_MAX_GRID_SIZE * BITBOARD_MAX_GRID_SIZE];
+  unsigned char ucarrKnownSensedTiles[BITBOARD_MAX_GRID_SIZE * BITBOARD_MAX_GRID_SIZE];
+  int nGridSize;
+
+  //The tiles LRRH has not sensed yet, and the ones of them granny's house can be on
+  int narrHiddenTiles[BITBOARD_MAX_GRID_SIZE * BITBOARD_MAX_GRID_SIZE];
+  int nNumOfHiddenTiles;
+  int narrGrannyTiles[BITBOARD_MAX_GRID_SIZE * BITBOARD_MAX_GRID_SIZE];
+  int nNumOfGrannyTiles;
+
+  //Chance of a hidden tile being a pit (pits sensed + 1 out of tiles sensed + 2)
+  int nPitChanceNumerator;
+  int nPitChanceDenominator;
+
+  //The sense values of the elements LRRH has not sensed yet, placed on the hidden tiles of every sampled playing grid
+  int narrMissingElements[NUM_OF_OBJECTIVES + 2];
+  int nNumOfMissingElements;
+
+  //Bit (1 << value) of each objective LRRH still needs, and of each element she still has to find before going to them
+  int nNeededObjectives;
+  int nUnsensedTargets;
+
+  //The tiles the rollouts choose from
+  int narrCandidateTiles[ROLLOUT_NUM_OF_CANDIDATES];
+  int nNumOfCandidates;
+
+  //The game's random numbers, and the number of the first substream of this choice
+  RandomGenerator * pGenerator;
+  unsigned int unFirstStreamId;
+
+} RolloutModel;
+
+//A range of rollouts played by a single thread, with the buffers it reuses for every choice
+typedef struct
+{
+  RolloutModel * pModel;
+  int nFirstRollout;
+  int nNumOfRollouts;
+
+  //The sampled playing grid, and the tiles LRRH has sensed so far in the rollout
+  signed char scarrSampledTiles[BITBOARD_MAX_GRID_SIZE * BITBOARD_MAX_GRID_SIZE];
+  unsigned char ucarrSensedTiles[BITBOARD_MAX_GRID_SIZE * BITBOARD_MAX_GRID_SIZE];
+
+  /*The distances and queue of the breadth first search. A tile is only reached in the current search if its stamp is
+    the stamp of the search, so the distances never have to be cleared.*/
+  int narrDistances[BITBOARD_MAX_GRID_SIZE * BITBOARD_MAX_GRID_SIZE];
+  int narrSearchQueue[BITBOARD_MAX_GRID_SIZE * BITBOARD_MAX_GRID_SIZE];
+  int narrSearchStamps[BITBOARD_MAX_GRID_SIZE * BITBOARD_MAX_GRID_SIZE];
+  int nSearchStamp;
+
+  //Number of actions LRRH needed after each candidate, added up over the rollouts of the range
+  long long llarrCosts[ROLLOUT_NUM_OF_CANDIDATES];
+
+  HANDLE hWorkerThread;
+
+} RolloutWorker;
+
+typedef struct
+{
+  RolloutModel Model;
+
+  //The workers are kept for the whole game, so that a choice does not allocate anything
+  RolloutWorker * pWorkers;
+  int nNumOfThreads;
+  int nNumOfRollouts;
+
+  //Number of choices made so far, which gives each choice its own substreams
+  unsigned int unNumOfChoices;
+
+} RolloutPlanner;
+
+void    initRolloutPlanner              (RolloutPlanner * pPlanner,
+                                        RandomGenerator * pGenerator,
+                                        int nNumOfRollouts,
+                                        int nNumOfThreads);
+void    clearRolloutPlanner             (RolloutPlanner * pPlanner);
+int     getRolloutNeighbors             (int nTile,
+                                        int nGridSize,
+                                        int * pNeighbors);
+int     searchRolloutDistance           (RolloutWorker * pWorker,
+                                        int nStartTile,
+                                        int nTargetValue,
+                                        int * pTargetTile);
+int     senseRolloutNeighbors           (RolloutWorker * pWorker,
+                                        int nTile,
+                                        int * pUnsensedTargets);
+void    sampleRolloutTiles              (RolloutModel * pModel,
+                                        RandomGenerator * pGenerator,
+                                        signed char * pTiles);
+int     computeRolloutCost              (RolloutWorker * pWorker,
+                                        int nStartTile);
+void    playRollouts                    (RolloutWorker * pWorker);
+DWORD WINAPI    runRolloutWorker        (LPVOID pParameter);
+void    chooseRolloutFrontierTile       (RolloutPlanner * pPlanner,
+                                        GameState * pGame);
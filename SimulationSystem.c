@@ -0,0 +1,364 @@
+/*
+* Programmed By: Aaron Gabrielle Dichoso
+*
+* Description:
+* 	SimulationSystem.c: A simulation system to be used for the Machine Project.
+*       Plays many games of random mode on the same board at the same time. Every game is one lane of a set of arrays,
+*       and each turn is applied to every lane with the same instructions, so the compiler can turn the loop into
+*       vector instructions. The random numbers of each game only depend on its game number, so the results are the
+*       same no matter how many threads are used.
+*
+* Last Modified: 19/10/2026
+* Acknowledgements:
+*       Parallel Random Numbers: As Easy as 1, 2, 3 (Philox) - https://www.thesalmons.org/john/random123/papers/random123sc11.pdf
+*       Fast alternative to the modulo reduction - https://lemire.me/blog/2016/06/27/a-fast-alternative-to-the-modulo-reduction/
+*       FNV hash - http://www.isthe.com/chongo/tech/comp/fnv/index.html
+*       AoS and SoA - https://en.wikipedia.org/wiki/AoS_and_SoA
+*/
+
+#include "SimulationSystem_prototype.h"
+
+/* This function builds the table of next states of every state of a board, using the same rules as random mode.
+   The win and loss states are added after the last state of the board. Like random mode, a game stops as soon as it
+   reaches a state that can never end, so moving into one of them leads to the loss state instead.
+        @param   (BatchModel *)  pModel is the pointer to the model to build
+        @param   (char *)  pPlayGrid is the pointer to carrPlayGrid (after every object has been placed)
+        @param   (int)  nStartXLocation is the X location LRRH starts at
+        @param   (int)  nStartYLocation is the Y location LRRH starts at
+        @param   (int)  nGridSize is the size of the playing grid
+
+        @return  (void) no return value
+*/
+void
+initBatchModel (BatchModel * pModel, char * pPlayGrid, int nStartXLocation, int nStartYLocation, int nGridSize)
+{
+        int nNumOfStates = nGridSize * nGridSize * NUM_OF_DIRECTIONS * ANALYSIS_NUM_OF_ITEM_SETS;
+        int i, j;
+
+        pModel->nWinState = nNumOfStates;
+        pModel->nLossState = nNumOfStates + 1;
+        pModel->pTransitions = malloc ((nNumOfStates + 2) * BATCH_NUM_OF_ACTIONS * sizeof(int));
+        pModel->pCanEndStates = malloc (nNumOfStates);
+
+        markEndingAnalysisStates (pPlayGrid, nStartXLocation, nStartYLocation, nGridSize, pModel->pCanEndStates);
+
+        for (i = 0; i < nNumOfStates; i++)
+        {
+                int * pNextStates = pModel->pTransitions + i * BATCH_NUM_OF_ACTIONS;
+                int nForwardState = moveAnalysisStateForward (i, pPlayGrid, nStartXLocation, nStartYLocation, nGridSize);
+
+                pNextStates[BATCH_ACTION_ROTATE_LEFT] = rotateAnalysisState (i, 0);
+                pNextStates[BATCH_ACTION_ROTATE_RIGHT] = rotateAnalysisState (i, 1);
+                pNextStates[BATCH_ACTION_SENSE] = i;
+
+                //Facing the edge, moving forward rotates LRRH to the right instead
+                if (nForwardState == ANALYSIS_STATE_BLOCKED)
+                        pNextStates[BATCH_ACTION_FORWARD] = pNextStates[BATCH_ACTION_ROTATE_RIGHT];
+                else if (nForwardState == ANALYSIS_STATE_WIN)
+                        pNextStates[BATCH_ACTION_FORWARD] = pModel->nWinState;
+                else if (nForwardState == ANALYSIS_STATE_LOSS)
+                        pNextStates[BATCH_ACTION_FORWARD] = pModel->nLossState;
+                else
+                        pNextStates[BATCH_ACTION_FORWARD] = nForwardState;
+
+                for (j = 0; j < BATCH_NUM_OF_ACTIONS; j++)
+                {
+                        if (pNextStates[j] < nNumOfStates && !pModel->pCanEndStates[pNextStates[j]])
+                                pNextStates[j] = pModel->nLossState;
+                }
+        }
+
+        //Once a game has ended, it stays ended whatever the action is
+        for (j = 0; j < BATCH_NUM_OF_ACTIONS; j++)
+        {
+                pModel->pTransitions[pModel->nWinState * BATCH_NUM_OF_ACTIONS + j] = pModel->nWinState;
+                pModel->pTransitions[pModel->nLossState * BATCH_NUM_OF_ACTIONS + j] = pModel->nLossState;
+        }
+
+        //Same ranges of random numbers as chooseRandomAction
+        for (i = 0; i <= RANDOM_ACTION_MAX_NUMBER; i++)
+        {
+                if (i <= RANDOM_ROTATE_LEFT_MAX_NUMBER)
+                        pModel->ucarrActions[i] = BATCH_ACTION_ROTATE_LEFT;
+                else if (i <= RANDOM_FORWARD_MAX_NUMBER)
+                        pModel->ucarrActions[i] = BATCH_ACTION_FORWARD;
+                else if (i <= RANDOM_ROTATE_RIGHT_MAX_NUMBER)
+                        pModel->ucarrActions[i] = BATCH_ACTION_ROTATE_RIGHT;
+                else
+                        pModel->ucarrActions[i] = BATCH_ACTION_SENSE;
+        }
+
+        //2^32 mod (RANDOM_ACTION_MAX_NUMBER + 1), the same threshold generateRandomNumber rejects under
+        pModel->unRejectThreshold = (0u - (RANDOM_ACTION_MAX_NUMBER + 1)) % (RANDOM_ACTION_MAX_NUMBER + 1);
+}
+
+/* This function frees the tables of a model
+        @param   (BatchModel *)  pModel is the pointer to the model
+
+        @return  (void) no return value
+*/
+void
+clearBatchModel (BatchModel * pModel)
+{
+        free (pModel->pTransitions);
+        free (pModel->pCanEndStates);
+        pModel->pTransitions = NULL;
+        pModel->pCanEndStates = NULL;
+}
+
+/* This function advances every lane by a number of turns. There are no branches inside the loop: each lane takes
+   its next random number, looks up its action, and looks up its next state. A game that has ended stays on the win
+   or loss state, and stops counting turns. A game that has taken as many turns as the turn limit stays where it is.
+
+   Each lane computes a Philox block for its game once every PHILOX_BLOCK_SIZE turns, and uses its numbers in the same order
+   as getNextRandomNumber. A number that generateRandomNumber would draw again is skipped without doing an action, so
+   every game plays out exactly like random mode would with the same seed, board and game.
+        @param   (BatchModel *)  pModel is the pointer to the model of the board
+        @param   (BatchLanes *)  pLanes is the pointer to the games being simulated
+        @param   (int)  nNumOfTurns is the number of turns to advance (a multiple of PHILOX_BLOCK_SIZE)
+
+        @return  (void) no return value
+*/
+void
+advanceBatchLanes (BatchModel * pModel, BatchLanes * pLanes, int nNumOfTurns)
+{
+        int * pTransitions = pModel->pTransitions;
+        unsigned char * pActions = pModel->ucarrActions;
+        unsigned int unRejectThreshold = pModel->unRejectThreshold;
+        int nWinState = pModel->nWinState;
+        int nTurnLimit = pModel->nTurnLimit;
+        int nTurn, i, j;
+
+        for (nTurn = 0; nTurn < nNumOfTurns; nTurn += PHILOX_BLOCK_SIZE)
+        {
+                for (i = 0; i < BATCH_NUM_OF_LANES; i++)
+                {
+                        unsigned int unarrCounter[4] = {pLanes->unarrBlockIndexes[i], pLanes->unarrGameIds[i], pModel->unBoardId, 0};
+                        unsigned int unarrBlock[PHILOX_BLOCK_SIZE];
+                        int nState = pLanes->narrStates[i];
+                        int nNumOfTurnsTaken = pLanes->narrNumOfTurns[i];
+
+                        computePhiloxBlock (unarrCounter, pModel->unarrKey, unarrBlock);
+                        pLanes->unarrBlockIndexes[i]++;
+
+                        for (j = 0; j < PHILOX_BLOCK_SIZE; j++)
+                        {
+                                //Scale the random number down to 0 to RANDOM_ACTION_MAX_NUMBER without a division
+                                unsigned long long ullProduct = (unsigned long long) unarrBlock[j] * (RANDOM_ACTION_MAX_NUMBER + 1);
+                                int nIsAccepted = (unsigned int) ullProduct >= unRejectThreshold;
+                                int nAction = pActions[ullProduct >> 32];
+
+                                //The win and loss states are the only states at or after nWinState
+                                int nDoesTurn = nIsAccepted & (nState < nWinState) & (nNumOfTurnsTaken < nTurnLimit);
+                                int nNextState = pTransitions[nState * BATCH_NUM_OF_ACTIONS + nAction];
+
+                                nNumOfTurnsTaken += nDoesTurn;
+                                nState = nDoesTurn ? nNextState : nState;
+                        }
+
+                        pLanes->narrStates[i] = nState;
+                        pLanes->narrNumOfTurns[i] = nNumOfTurnsTaken;
+                }
+        }
+}
+
+/* This function gives a number that tells boards apart, by hashing every tile of the playing grid (FNV-1a).
+   The same board always gives the same number.
+        @param   (char *)  pPlayGrid is the pointer to carrPlayGrid
+        @param   (int)  nGridSize is the size of the playing grid
+
+        @return  (unsigned int) the number of the board
+*/
+unsigned int
+hashPlayGrid (char * pPlayGrid, int nGridSize)
+{
+        unsigned int unHash = 2166136261u;
+        int i;
+
+        for (i = 0; i < nGridSize * nGridSize; i++)
+        {
+                unHash ^= (unsigned char) pPlayGrid[i];
+                unHash *= 16777619u;
+        }
+
+        //The size is hashed too, so a board and the same tiles on a bigger board are told apart
+        unHash ^= (unsigned int) nGridSize;
+        unHash *= 16777619u;
+
+        return unHash;
+}
+
+/* This function simulates a range of games on the lanes. Every BATCH_CHECK_INTERVAL turns, the games that have ended
+   or reached the turn limit are counted and their lanes start the next game, so no lane waits long for the slowest game.
+        @param   (BatchWorker *)  pWorker is the pointer to the range of games, its results are saved in it
+
+        @return  (void) no return value
+*/
+void
+simulateBatchGames (BatchWorker * pWorker)
+{
+        BatchModel * pModel = pWorker->pModel;
+        BatchResult * pResult = &pWorker->Result;
+        BatchLanes Lanes;
+
+        int nNumOfStartedGames = 0;
+        int nNumOfRunningGames = 0;
+        int i;
+
+        pResult->nNumOfGames = 0;
+        pResult->nNumOfWins = 0;
+        pResult->llTotalNumOfTurns = 0;
+
+        //If the game cannot end from the start, every game is stopped before its first turn
+        if (pWorker->nStartState >= pModel->nWinState){
+                pResult->nNumOfGames = pWorker->nNumOfGames;
+                return;
+        }
+
+        //Start a game on every lane, the lanes without a game stay on the loss state and are never counted
+        for (i = 0; i < BATCH_NUM_OF_LANES; i++)
+        {
+                Lanes.narrNumOfTurns[i] = 0;
+                Lanes.unarrGameIds[i] = 0;
+                Lanes.unarrBlockIndexes[i] = 0;
+                Lanes.narrStates[i] = pModel->nLossState;
+
+                if (nNumOfStartedGames < pWorker->nNumOfGames){
+                        Lanes.narrStates[i] = pWorker->nStartState;
+                        Lanes.unarrGameIds[i] = pWorker->unFirstGameId + nNumOfStartedGames;
+                        nNumOfStartedGames++;
+                        nNumOfRunningGames++;
+                }
+        }
+
+        while (nNumOfRunningGames > 0)
+        {
+                advanceBatchLanes (pModel, &Lanes, BATCH_CHECK_INTERVAL);
+
+                //Count the games that have ended, then give their lanes the next game if there are games left
+                for (i = 0; i < BATCH_NUM_OF_LANES; i++)
+                {
+                        int nHasEnded = Lanes.narrStates[i] >= pModel->nWinState && Lanes.narrNumOfTurns[i] > 0;
+
+                        if (nHasEnded || Lanes.narrNumOfTurns[i] >= pModel->nTurnLimit){
+                                pResult->nNumOfGames++;
+                                pResult->nNumOfWins += Lanes.narrStates[i] == pModel->nWinState;
+                                pResult->llTotalNumOfTurns += Lanes.narrNumOfTurns[i];
+                                nNumOfRunningGames--;
+
+                                //A lane stopped by the turn limit is still on a state of the board, so it is moved off it
+                                Lanes.narrNumOfTurns[i] = 0;
+                                Lanes.narrStates[i] = pModel->nLossState;
+
+                                if (nNumOfStartedGames < pWorker->nNumOfGames){
+                                        Lanes.narrStates[i] = pWorker->nStartState;
+                                        Lanes.unarrGameIds[i] = pWorker->unFirstGameId + nNumOfStartedGames;
+                                        Lanes.unarrBlockIndexes[i] = 0;
+                                        nNumOfStartedGames++;
+                                        nNumOfRunningGames++;
+                                }
+                        }
+                }
+        }
+}
+
+/* This function is run by each worker thread of a batch
+        @param   (LPVOID)  pParameter is the pointer to the worker
+
+        @return  (DWORD) always returns 0
+*/
+DWORD WINAPI
+runBatchWorker (LPVOID pParameter)
+{
+        simulateBatchGames ((BatchWorker *) pParameter);
+
+        return 0;
+}
+
+/* This function plays many games of random mode on the same board to estimate how often LRRH wins.
+   The games are split into ranges of game numbers, one range for each thread. Since every game only depends on
+   (seed, board, game) and the results are whole number sums, the results are exactly the same for any number of threads.
+        @param   (char *)  pPlayGrid is the pointer to carrPlayGrid (after every object has been placed)
+        @param   (int)  nStartXLocation is the X location LRRH starts at
+        @param   (int)  nStartYLocation is the Y location LRRH starts at
+        @param   (char)  cStartDirection is the direction LRRH starts facing (Ex: DIRECTION_SOUTH)
+        @param   (int)  nGridSize is the size of the playing grid
+        @param   (unsigned long long)  ullSeed is the seed shared by every game
+        @param   (unsigned int)  unBoardId is the number of the board (Ex: from hashPlayGrid)
+        @param   (unsigned int)  unFirstGameId is the number of the first game, the others follow it
+        @param   (int)  nNumOfGames is the number of games to play
+        @param   (int)  nNumOfThreads is the number of threads to play them on
+        @param   (int)  nTurnLimit is the number of turns a game can take before it is stopped (0 for no limit)
+        @param   (BatchResult *)  pResult is the pointer to where the results will be saved
+
+        @return  (void) no return value
+*/
+void
+simulateRandomLRRHBatch (char * pPlayGrid,
+                                int nStartXLocation,
+                                int nStartYLocation,
+                                char cStartDirection,
+                                int nGridSize,
+                                unsigned long long ullSeed,
+                                unsigned int unBoardId,
+                                unsigned int unFirstGameId,
+                                int nNumOfGames,
+                                int nNumOfThreads,
+                                int nTurnLimit,
+                                BatchResult * pResult)
+{
+        BatchModel Model;
+        BatchWorker Workers[nNumOfThreads];
+        int nNumOfAssignedGames = 0;
+        int i;
+
+        initBatchModel (&Model, pPlayGrid, nStartXLocation, nStartYLocation, nGridSize);
+
+        Model.unarrKey[0] = (unsigned int) ullSeed;
+        Model.unarrKey[1] = (unsigned int) (ullSeed >> 32);
+        Model.unBoardId = unBoardId;
+        Model.nTurnLimit = nTurnLimit > 0 ? nTurnLimit : INT_MAX;
+
+        int nStartState = encodeAnalysisState (nStartXLocation,
+                                                nStartYLocation,
+                                                convertDirectionSymbolToIndex (cStartDirection),
+                                                0,
+                                                nGridSize);
+
+        if (!Model.pCanEndStates[nStartState])
+                nStartState = Model.nLossState;
+
+        //Give each thread its own range of game numbers
+        for (i = 0; i < nNumOfThreads; i++)
+        {
+                BatchWorker * pWorker = &Workers[i];
+
+                pWorker->pModel = &Model;
+                pWorker->nStartState = nStartState;
+                pWorker->unFirstGameId = unFirstGameId + nNumOfAssignedGames;
+                pWorker->nNumOfGames = (nNumOfGames - nNumOfAssignedGames) / (nNumOfThreads - i);
+                nNumOfAssignedGames += pWorker->nNumOfGames;
+
+                //If the thread could not be made, the games are simulated by the calling thread later on
+                pWorker->hWorkerThread = CreateThread (NULL, 0, runBatchWorker, pWorker, 0, NULL);
+        }
+
+        pResult->nNumOfGames = 0;
+        pResult->nNumOfWins = 0;
+        pResult->llTotalNumOfTurns = 0;
+
+        for (i = 0; i < nNumOfThreads; i++)
+        {
+                if (Workers[i].hWorkerThread != NULL){
+                        WaitForSingleObject (Workers[i].hWorkerThread, INFINITE);
+                        CloseHandle (Workers[i].hWorkerThread);
+                } else
+                        simulateBatchGames (&Workers[i]);
+
+                pResult->nNumOfGames += Workers[i].Result.nNumOfGames;
+                pResult->nNumOfWins += Workers[i].Result.nNumOfWins;
+                pResult->llTotalNumOfTurns += Workers[i].Result.llTotalNumOfTurns;
+        }
+
+        clearBatchModel (&Model);
+}
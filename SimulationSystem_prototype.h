@@ -0,0 +1,116 @@
+/*
+* Programmed By: Aaron Gabrielle Dichoso
+*
+* Description:
+* 	SimulationSystem_prototype.h: Contains the function prototypes of SimulationSystem.c
+*
+* Last Modified: 19/10/2026
+*/
+
+//Actions of random mode, in the order of their ranges of random numbers
+#define BATCH_ACTION_ROTATE_LEFT 0
+#define BATCH_ACTION_FORWARD 1
+#define BATCH_ACTION_ROTATE_RIGHT 2
+#define BATCH_ACTION_SENSE 3
+#define BATCH_NUM_OF_ACTIONS 4
+
+//Number of games advanced together in lockstep
+#define BATCH_NUM_OF_LANES 1024
+
+//Number of lockstep turns between checking which games have ended (a multiple of PHILOX_BLOCK_SIZE)
+#define BATCH_CHECK_INTERVAL 32
+
+//Number of games simulated for a board in random mode, and the number of threads simulating them
+#define BATCH_DEFAULT_NUM_OF_GAMES 100000
+#define BATCH_DEFAULT_NUM_OF_THREADS 4
+
+//Every state of a board, with the next state of each action already worked out
+typedef struct
+{
+  //Next state of each state and action, at index (State * BATCH_NUM_OF_ACTIONS + Action)
+  int * pTransitions;
+
+  //The two extra states a game ends in, both of them always lead back to themselves
+  int nWinState;
+  int nLossState;
+
+  //Whether or not the game can still end from each state of the board (1 if it can, 0 if not)
+  unsigned char * pCanEndStates;
+
+  //Number of turns a game can take before it is stopped
+  int nTurnLimit;
+
+  //Action of each random number from 0 to RANDOM_ACTION_MAX_NUMBER
+  unsigned char ucarrActions[RANDOM_ACTION_MAX_NUMBER + 1];
+
+  //Random numbers whose low bits are under this are drawn again, the same as generateRandomNumber
+  unsigned int unRejectThreshold;
+
+  //Key and board of the random streams of the games
+  unsigned int unarrKey[2];
+  unsigned int unBoardId;
+
+} BatchModel;
+
+//Games being simulated, each array holds one value per lane (structure of arrays)
+typedef struct
+{
+  //Analysis state of each game (position, direction and items), or the win or loss state once it has ended
+  int narrStates[BATCH_NUM_OF_LANES];
+
+  //Number of turns each game has taken
+  int narrNumOfTurns[BATCH_NUM_OF_LANES];
+
+  //Game of each lane, which picks its random stream, and the next block of that stream
+  unsigned int unarrGameIds[BATCH_NUM_OF_LANES];
+  unsigned int unarrBlockIndexes[BATCH_NUM_OF_LANES];
+
+} BatchLanes;
+
+typedef struct
+{
+  int nNumOfGames;
+  int nNumOfWins;
+  long long llTotalNumOfTurns;
+
+} BatchResult;
+
+//A range of games simulated by a single thread
+typedef struct
+{
+  BatchModel * pModel;
+  int nStartState;
+  unsigned int unFirstGameId;
+  int nNumOfGames;
+  BatchResult Result;
+
+  //The thread simulating the games (NULL if they are simulated by the calling thread)
+  HANDLE hWorkerThread;
+
+} BatchWorker;
+
+void    initBatchModel                  (BatchModel * pModel,
+                                        char * pPlayGrid,
+                                        int nStartXLocation,
+                                        int nStartYLocation,
+                                        int nGridSize);
+void    clearBatchModel                 (BatchModel * pModel);
+void    advanceBatchLanes               (BatchModel * pModel,
+                                        BatchLanes * pLanes,
+                                        int nNumOfTurns);
+void    simulateBatchGames              (BatchWorker * pWorker);
+DWORD WINAPI    runBatchWorker          (LPVOID pParameter);
+unsigned int hashPlayGrid               (char * pPlayGrid,
+                                        int nGridSize);
+void    simulateRandomLRRHBatch         (char * pPlayGrid,
+                                        int nStartXLocation,
+                                        int nStartYLocation,
+                                        char cStartDirection,
+                                        int nGridSize,
+                                        unsigned long long ullSeed,
+                                        unsigned int unBoardId,
+                                        unsigned int unFirstGameId,
+                                        int nNumOfGames,
+                                        int nNumOfThreads,
+                                        int nTurnLimit,
+                                        BatchResult * pResult);
@@ -0,0 +1,229 @@
+/*
+* Programmed By: Aaron Gabrielle Dichoso
+*
+* Description:
+* 	StrategySystem.c: A strategy system to be used for the Machine Project.
+*       Plays a game with any agent given as a Strategy. An agent either decides LRRH's actions one at a time, which are
+*       done, counted, and displayed here the same way for every agent, or plays the whole game in its own loop.
+*       Either way the game is set up, counted, and ended by runGame, so agents can be compared on the same boards.
+*
+* Last Modified: 19/10/2026
+*/
+
+#include "StrategySystem_prototype.h"
+
+/* This function plays a game with an agent, from setting it up to freeing what it set up
+        @param   (GameState *)  pGame is the pointer to Game (LRRH, her items, the playing grid, and the random numbers)
+        @param   (Strategy *)  pStrategy is the pointer to the functions of the agent
+        @param   (StrategySettings *)  pSettings is the pointer to the settings the agent is played with
+
+        @return  (int) GAME_STOP_NONE if the game reached an ending, or why it was stopped before that
+*/
+int
+runStrategyLRRH (GameState * pGame,
+                Strategy * pStrategy,
+                StrategySettings * pSettings)
+{
+        void * pAgent = NULL;
+
+        if (pStrategy->pInitAgent != NULL)
+                pAgent = pStrategy->pInitAgent (pGame, pSettings);
+
+        int nStopReason;
+
+        if (pStrategy->pPlayGame != NULL)
+                nStopReason = pStrategy->pPlayGame (pAgent, pGame);
+        else
+                nStopReason = playStrategyActions (pGame, pStrategy, pAgent, pSettings->nTurnLimit);
+
+        if (pStrategy->pClearAgent != NULL)
+                pStrategy->pClearAgent (pAgent);
+
+        return nStopReason;
+}
+
+/* This function asks an agent for LRRH's actions one at a time and does them, until the game ends or is stopped
+        @param   (GameState *)  pGame is the pointer to Game
+        @param   (Strategy *)  pStrategy is the pointer to the functions of the agent
+        @param   (void *)  pAgent is the pointer the agent was set up with
+        @param   (int)  nTurnLimit is the number of actions LRRH can take before the game is stopped (0 for no limit)
+
+        @return  (int) GAME_STOP_NONE if the game reached an ending, or why it was stopped before that
+                (GAME_STOP_TURN_LIMIT, GAME_STOP_NO_ENDING, or GAME_STOP_NO_PROGRESS if the agent gave up)
+*/
+int
+playStrategyActions (GameState * pGame,
+                        Strategy * pStrategy,
+                        void * pAgent,
+                        int nTurnLimit)
+{
+        int nGridSize = pGame->nGridSize;
+
+        //Whether or not the game can still end from each state (position, direction and items), solved from the start
+        unsigned char * pCanEndStates = malloc (nGridSize * nGridSize * NUM_OF_DIRECTIONS * ANALYSIS_NUM_OF_ITEM_SETS);
+
+        markEndingAnalysisStates (pGame->pPlayGrid, pGame->nLRRHXLocation, pGame->nLRRHYLocation, nGridSize, pCanEndStates);
+
+        int nNumOfActions = 0;
+
+        //The game may not be able to end from the start
+        int nStopReason = checkStrategyStop (pGame, pCanEndStates, nNumOfActions, nTurnLimit);
+
+        while (nStopReason == GAME_STOP_NONE){
+                int nAction = pStrategy->pDecideAction (pAgent, pGame);
+
+                if (nAction == GAME_ACTION_NONE){
+                        nStopReason = GAME_STOP_NO_PROGRESS;
+                        break;
+                }
+
+                doStrategyAction (pGame, pStrategy, pAgent, nAction);
+                nNumOfActions++;
+
+                //Display the play grid to the user after every turn
+                displayPlayGrid (pGame->pPlayGrid, nGridSize, pGame->nNumOfSenses, pGame->nNumOfRotations, pGame->nNumOfMovements);
+                waitForNextTurn (&pGame->nNumOfTurns, pGame->nStepByStepMode, pGame->nHasSounds);
+
+                if (hasStrategyGameEnded (pGame))
+                        break;
+
+                nStopReason = checkStrategyStop (pGame, pCanEndStates, nNumOfActions, nTurnLimit);
+        }
+
+        free (pCanEndStates);
+
+        return nStopReason;
+}
+
+/* This function makes LRRH do an action an agent decided on, with the same rules as random mode
+   (a forward movement into the edge of the playing grid is a rotation to the right, and sensing it gives nothing)
+        @param   (GameState *)  pGame is the pointer to Game
+        @param   (Strategy *)  pStrategy is the pointer to the functions of the agent, told what LRRH senses
+        @param   (void *)  pAgent is the pointer the agent was set up with
+        @param   (int)  nAction is the GAME_ACTION to do
+
+        @return  (void) no return value
+*/
+void
+doStrategyAction (GameState * pGame,
+                        Strategy * pStrategy,
+                        void * pAgent,
+                        int nAction)
+{
+        int nGridSize = pGame->nGridSize;
+        char * pLRRHTile = pGame->pPlayGrid + pGame->nLRRHXLocation * nGridSize + pGame->nLRRHYLocation;
+
+        //The tile LRRH is facing
+        int nNextXLocation = pGame->nLRRHXLocation + convertDirectionSymbolToXMovement (pGame->cLRRHViewDirection);
+        int nNextYLocation = pGame->nLRRHYLocation + convertDirectionSymbolToYMovement (pGame->cLRRHViewDirection);
+        int nIsNextTileValid = isLocationValid (nNextXLocation, nNextYLocation, nGridSize - 1);
+
+        if (nAction == GAME_ACTION_FORWARD && !nIsNextTileValid)
+                nAction = GAME_ACTION_ROTATE_RIGHT;
+
+        switch (nAction){
+        case GAME_ACTION_ROTATE_LEFT:
+                rotateLeftLRRH (&pGame->nNumOfRotations, &pGame->cLRRHViewDirection, pLRRHTile);
+                break;
+        case GAME_ACTION_ROTATE_RIGHT:
+                rotateRightLRRH (&pGame->nNumOfRotations, &pGame->cLRRHViewDirection, pLRRHTile);
+                break;
+        case GAME_ACTION_SENSE:
+                if (nIsNextTileValid){
+                        char cSenseTile = senseLRRH (&pGame->nNumOfSenses,
+                                                        &pGame->nLRRHXLocation,
+                                                        &pGame->nLRRHYLocation,
+                                                        pLRRHTile,
+                                                        &pGame->cLRRHViewDirection,
+                                                        nGridSize);
+
+                        if (pStrategy->pObserveSense != NULL)
+                                pStrategy->pObserveSense (pAgent, pGame, nNextXLocation, nNextYLocation, cSenseTile);
+                } else
+                {
+                        //Facing the edge of the playing grid, there is nothing to sense
+                        pGame->nNumOfSenses++;
+                        displaySenseMessage (EMPTY_TILE);
+                }
+                break;
+        case GAME_ACTION_FORWARD:
+                pGame->cPreviousWalkedTileValue = forwardLRRH (&pGame->nNumOfMovements,
+                                                                &pGame->nLRRHXLocation,
+                                                                &pGame->nLRRHYLocation,
+                                                                pLRRHTile,
+                                                                &pGame->cLRRHViewDirection,
+                                                                nGridSize,
+                                                                pGame->cPreviousWalkedTileValue);
+
+                switch (pGame->cPreviousWalkedTileValue){
+                case FLOWER_TILE:
+                        pGame->nHasFlower = 1;
+                        break;
+                case BAKERY_TILE:
+                        pGame->nHasBread = 1;
+                        pGame->nWasBreadTaken = 0;
+                        break;
+                case WOODSMAN_TILE:
+                        pGame->nVisitedWoodsman = 1;
+
+                        //Calculate the distance from the woodsman and grandma's house and display it to the user
+                        displayWoodsmanLocation (computeWoodsmanDistance (pGame->nLRRHXLocation, pGame->nLRRHYLocation, pGame->pPlayGrid, nGridSize));
+                        break;
+                case WOLF_TILE:
+                        //The wolf only lets LRRH go if he can take her bread
+                        pGame->nWasBreadTaken = pGame->nHasBread;
+                        pGame->nHasBread = 0;
+
+                        if (pGame->nWasBreadTaken)
+                                displayWolfEatingBread ();
+                        break;
+                }
+                break;
+        }
+}
+
+/* This function checks whether or not LRRH has reached an ending on the tile she is standing on
+        @param   (GameState *)  pGame is the pointer to Game
+
+        @return  (int) 1 if she fell into a pit, was eaten by the wolf, or went to granny's house, else 0
+*/
+int
+hasStrategyGameEnded (GameState * pGame)
+{
+        char cTile = pGame->cPreviousWalkedTileValue;
+
+        return cTile == PIT_TILE || cTile == GRANDMA_TILE || (cTile == WOLF_TILE && !pGame->nWasBreadTaken);
+}
+
+/* This function checks whether or not a game that has not ended yet has to be stopped, because it can never end from
+   LRRH's state or because it has taken as many actions as its turn limit
+        @param   (GameState *)  pGame is the pointer to Game
+        @param   (unsigned char *)  pCanEndStates is the pointer to whether or not the game can still end from each state
+        @param   (int)  nNumOfActions is the number of actions LRRH has taken so far
+        @param   (int)  nTurnLimit is the number of actions LRRH can take before the game is stopped (0 for no limit)
+
+        @return  (int) GAME_STOP_NONE if the game can go on, else GAME_STOP_NO_ENDING or GAME_STOP_TURN_LIMIT
+*/
+int
+checkStrategyStop (GameState * pGame,
+                        unsigned char * pCanEndStates,
+                        int nNumOfActions,
+                        int nTurnLimit)
+{
+        int nItemFlags = (pGame->nHasFlower ? ANALYSIS_FLAG_FLOWER : 0) |
+                        (pGame->nHasBread ? ANALYSIS_FLAG_BREAD : 0) |
+                        (pGame->nVisitedWoodsman ? ANALYSIS_FLAG_WOODSMAN : 0);
+        int nState = encodeAnalysisState (pGame->nLRRHXLocation,
+                                                pGame->nLRRHYLocation,
+                                                convertDirectionSymbolToIndex (pGame->cLRRHViewDirection),
+                                                nItemFlags,
+                                                pGame->nGridSize);
+
+        if (!pCanEndStates[nState])
+                return GAME_STOP_NO_ENDING;
+
+        if (nTurnLimit > 0 && nNumOfActions >= nTurnLimit)
+                return GAME_STOP_TURN_LIMIT;
+
+        return GAME_STOP_NONE;
+}
@@ -0,0 +1,52 @@
+/*
+* Programmed By: Aaron Gabrielle Dichoso
+*
+* Description:
+* 	StrategySystem_prototype.h: Contains the function prototypes of StrategySystem.c
+*
+* Last Modified: 19/10/2026
+*/
+
+//Settings a strategy can be played with (each strategy only uses the ones it needs)
+typedef struct
+{
+  int nFrontierMode;
+  int nPlanningBudget;
+
+  //Number of actions an agent that decides one action at a time can take before the game is stopped (0 for no limit)
+  int nTurnLimit;
+
+} StrategySettings;
+
+//An agent that plays LRRH, given as the functions the game calls. Every function except one of pDecideAction and pPlayGame can be NULL.
+typedef struct
+{
+  //Sets up the agent for a game, and frees what it set up once the game is over. The pointer returned is given to the other functions.
+  void *  (*pInitAgent)           (GameState * pGame, StrategySettings * pSettings);
+  void    (*pClearAgent)          (void * pAgent);
+
+  //Picks LRRH's next GAME_ACTION (GAME_ACTION_NONE to give up), and is told what she sensed after each GAME_ACTION_SENSE
+  int     (*pDecideAction)        (void * pAgent, GameState * pGame);
+  void    (*pObserveSense)        (void * pAgent, GameState * pGame, int nXCoord, int nYCoord, char cSenseTile);
+
+  //Plays the whole game in the agent's own loop instead of one action at a time, and returns the GAME_STOP value of the game
+  int     (*pPlayGame)            (void * pAgent, GameState * pGame);
+
+} Strategy;
+
+int     runStrategyLRRH                 (GameState * pGame,
+                                        Strategy * pStrategy,
+                                        StrategySettings * pSettings);
+int     playStrategyActions             (GameState * pGame,
+                                        Strategy * pStrategy,
+                                        void * pAgent,
+                                        int nTurnLimit);
+void    doStrategyAction                (GameState * pGame,
+                                        Strategy * pStrategy,
+                                        void * pAgent,
+                                        int nAction);
+int     hasStrategyGameEnded            (GameState * pGame);
+int     checkStrategyStop               (GameState * pGame,
+                                        unsigned char * pCanEndStates,
+                                        int nNumOfActions,
+                                        int nTurnLimit);